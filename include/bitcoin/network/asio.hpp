@@ -60,6 +60,21 @@ namespace asio
     typedef tcp::socket socket;
     typedef std::shared_ptr<socket> socket_ptr;
 
+    /// socket options (tcp level options as available on the platform)
+    typedef tcp::no_delay no_delay;
+    typedef boost::asio::socket_base::keep_alive keep_alive;
+    typedef boost::asio::socket_base::send_buffer_size send_buffer_size;
+    typedef boost::asio::socket_base::receive_buffer_size receive_buffer_size;
+    template <int Name>
+    using tcp_option = boost::asio::detail::socket_option::integer<
+        IPPROTO_TCP, Name>;
+
+    /// Kernel load balancing of a shared bind (Linux semantics only).
+#if defined(HAVE_LINUX) && defined(SO_REUSEPORT)
+    typedef boost::asio::detail::socket_option::boolean<
+        SOL_SOCKET, SO_REUSEPORT> reuse_port;
+#endif
+
     /// asio::ssl::socket
     /// asio::ssl::context
     namespace ssl
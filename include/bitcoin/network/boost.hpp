@@ -38,6 +38,16 @@ BC_POP_WARNING()
     #define BOOST_ASIO_USE_WOLFSSL
 #endif
 
+/// io_uring is the reactor for all socket operations (epoll is disabled), as
+/// asio otherwise applies io_uring only to file operations. Asio selects its
+/// reactor at compile time, so there is no runtime fallback to epoll: the
+/// build requires kernel support (configure check) and io_context creation
+/// fails on a kernel without it. Submissions are batched by asio per run.
+#if defined(HAVE_IO_URING)
+    #define BOOST_ASIO_HAS_IO_URING
+    #define BOOST_ASIO_DISABLE_EPOLL
+#endif
+
 /// SSL is always defined, must be externally linked if !HAVE_SSL.
 #include <boost/asio/ssl.hpp>
 
@@ -109,6 +109,10 @@ protected:
     /// Stranded notifier, allows timer reset.
     void reading() NOEXCEPT override;
 
+    /// Charge sent bytes to the egress bucket of the channel, at the weight
+    /// of its service (options).
+    steady_clock::duration scheduled(size_t bytes) NOEXCEPT override;
+
 private:
     void stop_expiration() NOEXCEPT;
     void start_expiration() NOEXCEPT;
@@ -124,6 +128,7 @@ private:
     const options_t& options_;
     const settings_t& settings_;
     const uint64_t identifier_;
+    const egress::ptr scheduler_;
     const uint64_t nonce_
     {
         system::pseudo_random::next<uint64_t>(one, max_uint64)
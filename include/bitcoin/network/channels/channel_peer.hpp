@@ -41,6 +41,9 @@ public:
     using options_t = settings_t::tcp_server;
     using interface = rpc::interface::peer::dispatch;
     using dispatcher = rpc::dispatcher<interface>;
+    using relay_subscriber =
+        unsubscriber<const messages::peer::lazy::cptr&>;
+    using relay_handler = relay_subscriber::handler;
 
     /// Subscribe to messages from peer (requires strand).
     /// Event handler is always invoked on the channel strand.
@@ -52,11 +55,40 @@ public:
         dispatcher_.subscribe(std::forward<signature>(handler));
     }
 
+    /// Subscribe to relayable messages (tx, inv, addr) retained as read and
+    /// deserialized upon access (requires strand). Once subscribed, those that
+    /// are structurally valid are notified here and to message subscribers
+    /// (parsed only if subscribed, once, shared), and the payload may be sent
+    /// as read to other channels (see lazy).
+    /// Event handler is always invoked on the channel strand.
+    void subscribe_relay(relay_handler&& handler) NOEXCEPT;
+
+    /// Write retained message to peer (requires strand).
+    /// The payload is sent as read if the negotiated version matches, and is
+    /// otherwise reserialized. The message is queued by its priority class.
+    /// Completion handler is always invoked on the channel strand.
+    void send(const messages::peer::lazy::cptr& message,
+        result_handler&& handler) NOEXCEPT;
+
     /// Write message to peer (requires strand).
-    /// The message is translated to the wire by the body (transport framed).
+    /// The message is queued in the default priority class of its type.
     /// Completion handler is always invoked on the channel strand.
     template <class Message>
     inline void send(const Message& message, result_handler&& handler) NOEXCEPT
+    {
+        using namespace messages::peer;
+        send(message, to_priority(Message::identifier), std::move(handler));
+    }
+
+    /// Write message to peer (requires strand).
+    /// The message is translated to the wire by the body (transport framed).
+    /// The message is queued in the given priority class (see proxy). An
+    /// announcement may be dropped when congested (error::write_dropped),
+    /// which does not stop the channel.
+    /// Completion handler is always invoked on the channel strand.
+    template <class Message>
+    inline void send(const Message& message, messages::peer::priority level,
+        result_handler&& handler) NOEXCEPT
     {
         BC_ASSERT(stranded());
         using namespace messages::peer;
@@ -68,10 +100,12 @@ public:
         out.message = rpc::any_t{ system::to_shared(message) };
         out.index = rpc::peer_registry::index_of<Message>();
 
+        // Queued size is the v1 frame size (v2 differs by a few bytes).
+        const auto size = message.size(out.version);
         LOGX("Send " << Message::command << " to [" << endpoint() << "] ("
-            << message.size(out.version) << " bytes)");
+            << size << " bytes)");
 
-        write(std::move(out),
+        write(std::move(out), level, heading::size() + size,
             std::bind(&channel_peer::handle_send,
                 shared_from_base<channel_peer>(), _1, _2, Message::command,
                 std::move(handler)));
@@ -108,7 +142,7 @@ public:
     uint32_t negotiated_version() const NOEXCEPT;
     void set_negotiated_version(uint32_t value) NOEXCEPT;
 
-    /// Chain is current, reduces the read buffer to the configured minimum.
+    /// Chain is current (read buffers are pooled independent of this).
     bool current() const NOEXCEPT;
     void set_current(bool value) NOEXCEPT;
 
@@ -134,9 +168,13 @@ protected:
     /// For protocol version context.
     bool is_handshaked() const NOEXCEPT;
 
+    /// Notify relay (if retained) and message subscribers of the message.
+    code notify(messages::peer::frame& in) NOEXCEPT;
+
 private:
     void log_fault(const code& ec,
         const messages::peer::frame& in) const NOEXCEPT;
+    void handle_deferred(const code& ec) NOEXCEPT;
     void handle_send(const code& ec, size_t size,
         const std::string& command, const result_handler& handler) NOEXCEPT;
 
@@ -145,6 +183,7 @@ private:
     messages::peer::version::cptr peer_version_{};
     system::data_chunk payload_buffer_{};
     dispatcher dispatcher_{};
+    relay_subscriber relay_subscriber_{};
     size_t start_height_{};
     bool reading_{};
     bool quiet_{};
@@ -70,6 +70,7 @@ enum error_t : uint8_t
     protocol_violation,
     channel_overflow,
     channel_underflow,
+    write_dropped,
 
     // incoming connection failures
     listen_failed,
@@ -34,6 +34,13 @@
     #define HAVE_SSL
 #endif
 
+/// This enables the asio io_uring backend in place of epoll (Linux only).
+/// Reactor selection is compile-time in asio, with no runtime fallback or
+/// setting, so the build is checked for kernel support (see boost.hpp).
+#if defined(WITH_IO_URING) && defined(__linux__)
+    #define HAVE_IO_URING
+#endif
+
 /// TODO: Move to build configuration.
 ////#define WITH_EVENTS
 #define WITH_LOGGING
@@ -290,6 +290,37 @@ const typename CLASS::notifiers_t
 CLASS::notifiers_ = CLASS::make_notifiers(
     std::make_index_sequence<Interface::size>{});
 
+// make_emptiers
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <size_t Index>
+inline bool CLASS::empty(const dispatcher& self) NOEXCEPT
+{
+    return std::get<Index>(self.subscribers_).empty();
+}
+
+TEMPLATE
+template <size_t ...Index>
+inline CLASS::emptiers_t CLASS::make_emptiers(
+    std::index_sequence<Index...>) NOEXCEPT
+{
+    // Emptiers are declared statically (same for all distributors instances).
+    return
+    {
+        std::make_pair
+        (
+            std::string{ method_t<Index, methods_t>::name },
+            &CLASS::empty<Index>
+        )...
+    };
+}
+
+TEMPLATE
+const typename CLASS::emptiers_t
+CLASS::emptiers_ = CLASS::make_emptiers(
+    std::make_index_sequence<Interface::size>{});
+
 // make_subscribers/subscribe
 // ----------------------------------------------------------------------------
 
@@ -360,6 +391,13 @@ bool CLASS::contains(const std::string& method) NOEXCEPT
     return CLASS::notifiers_.contains(method);
 }
 
+TEMPLATE
+bool CLASS::subscribed(const std::string& method) const NOEXCEPT
+{
+    const auto it = CLASS::emptiers_.find(method);
+    return it != CLASS::emptiers_.end() && !it->second(*this);
+}
+
 TEMPLATE
 inline code CLASS::notify(const request_t& request) NOEXCEPT
 {
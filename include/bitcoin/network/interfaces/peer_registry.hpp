@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_NETWORK_INTERFACES_PEER_REGISTRY_HPP
 #define LIBBITCOIN_NETWORK_INTERFACES_PEER_REGISTRY_HPP
 
+#include <algorithm>
 #include <array>
 #include <span>
 #include <tuple>
@@ -63,10 +64,16 @@ private:
     using span_t = std::span<const uint8_t>;
     using deserializer_t = any_t(*)(const span_t&, uint32_t, bool);
     using deserializers_t = std::array<deserializer_t, size>;
+    using taker_t = any_t(*)(system::data_chunk&&, uint32_t, bool);
+    using takers_t = std::array<taker_t, size>;
     using serializer_t = system::chunk_ptr(*)(const any_t&, uint32_t, uint32_t);
     using serializers_t = std::array<serializer_t, size>;
     using payloader_t = system::chunk_ptr(*)(const any_t&, uint32_t);
     using payloaders_t = std::array<payloader_t, size>;
+    using sizer_t = size_t(*)(const any_t&, uint32_t);
+    using sizers_t = std::array<sizer_t, size>;
+    using writer_t = bool(*)(const any_t&, uint32_t, const system::data_slab&);
+    using writers_t = std::array<writer_t, size>;
 
     template <size_t Index>
     static any_t deserialize(const span_t& data, uint32_t version,
@@ -83,11 +90,57 @@ private:
         return message_ptr ? any_t{ message_ptr } : any_t{};
     }
 
+    // A message that owns its payload (e.g. block) takes the chunk, otherwise
+    // the message is parsed from the chunk in place (the chunk is retained).
+    // A chunk with excess (pooled) capacity is not taken, as the message would
+    // pin that capacity for its lifetime. An exact copy is taken instead, and
+    // the chunk remains with the caller (for return to the buffer pool).
+    template <size_t Index>
+    static any_t deserialize_take(system::data_chunk&& data, uint32_t version,
+        bool witness) NOEXCEPT
+    {
+        using message = message_t<Index>;
+        typename message::cptr message_ptr{};
+
+        if constexpr (requires { message::deserialize(version,
+            std::move(data), witness); })
+            message_ptr = message::deserialize(version,
+                data.capacity() > data.size() ?
+                    system::data_chunk{ data.begin(), data.end() } :
+                    std::move(data), witness);
+        else
+            message_ptr = message::deserialize(version, span_t{ data });
+
+        return message_ptr ? any_t{ message_ptr } : any_t{};
+    }
+
+    // A retained (lazy) message is written as read in a matching context.
+    static messages::peer::lazy::cptr reused(const any_t& message,
+        uint32_t version) NOEXCEPT
+    {
+        const auto retained = message.get<const messages::peer::lazy>();
+        return retained && retained->reusable(version) ? retained :
+            messages::peer::lazy::cptr{};
+    }
+
+    // A retained (lazy) message is otherwise deserialized (once) for writing.
+    template <size_t Index>
+    static cptr_t<Index> to_message(const any_t& message) NOEXCEPT
+    {
+        if (const auto retained = message.get<const messages::peer::lazy>())
+            return retained->get<message_t<Index>>();
+
+        return message.get<const message_t<Index>>();
+    }
+
     template <size_t Index>
     static system::chunk_ptr serialize(const any_t& message, uint32_t magic,
         uint32_t version) NOEXCEPT
     {
-        const auto ptr = message.get<const message_t<Index>>();
+        if (const auto retained = reused(message, version))
+            return retained->to_frame(magic);
+
+        const auto ptr = to_message<Index>(message);
         return ptr ? messages::peer::serialize(*ptr, magic, version) :
             system::chunk_ptr{};
     }
@@ -96,11 +149,42 @@ private:
     static system::chunk_ptr serialize_payload(const any_t& message,
         uint32_t version) NOEXCEPT
     {
-        const auto ptr = message.get<const message_t<Index>>();
+        if (const auto retained = reused(message, version))
+            return system::to_shared<system::data_chunk>(*retained->payload());
+
+        const auto ptr = to_message<Index>(message);
         return ptr ? messages::peer::serialize(*ptr, version) :
             system::chunk_ptr{};
     }
 
+    template <size_t Index>
+    static size_t payload_size(const any_t& message, uint32_t version) NOEXCEPT
+    {
+        if (const auto retained = reused(message, version))
+            return retained->payload()->size();
+
+        const auto ptr = to_message<Index>(message);
+        return ptr ? ptr->size(version) : zero;
+    }
+
+    template <size_t Index>
+    static bool write_payload(const any_t& message, uint32_t version,
+        const system::data_slab& out) NOEXCEPT
+    {
+        if (const auto retained = reused(message, version))
+        {
+            const auto& payload = *retained->payload();
+            if (out.size() < payload.size())
+                return false;
+
+            std::copy(payload.begin(), payload.end(), out.begin());
+            return true;
+        }
+
+        const auto ptr = to_message<Index>(message);
+        return ptr && ptr->serialize(version, out);
+    }
+
     template <size_t... Index>
     static constexpr serializers_t make_serializers(
         std::index_sequence<Index...>) NOEXCEPT
@@ -115,6 +199,20 @@ private:
         return { &peer_registry::serialize_payload<Index>... };
     }
 
+    template <size_t... Index>
+    static constexpr sizers_t make_sizers(
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        return { &peer_registry::payload_size<Index>... };
+    }
+
+    template <size_t... Index>
+    static constexpr writers_t make_writers(
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        return { &peer_registry::write_payload<Index>... };
+    }
+
     template <size_t... Index>
     static constexpr commands_t make_commands(
         std::index_sequence<Index...>) NOEXCEPT
@@ -151,6 +249,13 @@ private:
         return { &peer_registry::deserialize<Index>... };
     }
 
+    template <size_t... Index>
+    static constexpr takers_t make_takers(
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        return { &peer_registry::deserialize_take<Index>... };
+    }
+
     template <size_t... Index>
     static constexpr size_t to_index(const std::string_view& command,
         std::index_sequence<Index...>) NOEXCEPT
@@ -222,6 +327,19 @@ public:
             any_t{};
     }
 
+    /// Deserialize from a caller chunk, which is moved into a message that
+    /// owns its payload (block) when exactly sized, and otherwise remains
+    /// unchanged.
+    static any_t to_any(size_t index, system::data_chunk&& data,
+        uint32_t version, bool witness) NOEXCEPT
+    {
+        static constexpr auto table = make_takers(
+            std::make_index_sequence<size>{});
+
+        return index < size ? table.at(index)(std::move(data), version,
+            witness) : any_t{};
+    }
+
     static system::chunk_ptr to_frame(size_t index, const any_t& message,
         uint32_t magic, uint32_t version) NOEXCEPT
     {
@@ -241,6 +359,26 @@ public:
         return index < size ? table.at(index)(message, version) :
             system::chunk_ptr{};
     }
+
+    /// Serialized payload size (zero if index or message type is invalid).
+    static size_t to_payload_size(size_t index, const any_t& message,
+        uint32_t version) NOEXCEPT
+    {
+        static constexpr auto table = make_sizers(
+            std::make_index_sequence<size>{});
+
+        return index < size ? table.at(index)(message, version) : zero;
+    }
+
+    /// Serialize the payload in place (out is sized by to_payload_size).
+    static bool to_payload(size_t index, const any_t& message,
+        uint32_t version, const system::data_slab& out) NOEXCEPT
+    {
+        static constexpr auto table = make_writers(
+            std::make_index_sequence<size>{});
+
+        return index < size && table.at(index)(message, version, out);
+    }
 };
 
 } // namespace rpc
@@ -19,7 +19,10 @@
 #ifndef LIBBITCOIN_NETWORK_MEMORY_HPP
 #define LIBBITCOIN_NETWORK_MEMORY_HPP
 
+#include <array>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <bitcoin/network/define.hpp>
 
 namespace libbitcoin {
@@ -48,6 +51,65 @@ public:
     arena* get_arena() NOEXCEPT override;
 };
 
+/// Thread safe pool of byte buffers in power-of-two size classes, shared by
+/// channels. A buffer is borrowed for the duration of a read and returned upon
+/// its completion, so that retained memory tracks concurrent reads rather than
+/// the number of channels. Sizes above the largest class are not pooled.
+class BCT_API buffer_pool
+{
+public:
+    /// Size classes are 2^minimum_class (4KiB) to 2^maximum_class (4MiB).
+    static constexpr size_t minimum_class = 12;
+    static constexpr size_t maximum_class = 22;
+    static constexpr size_t classes = system::add1(maximum_class - minimum_class);
+
+    /// Default limit on the bytes retained by the process-wide pool.
+    static constexpr size_t default_limit = 64u * 1024u * 1024u;
+
+    struct statistics
+    {
+        /// Borrows satisfied from the pool (reused) or by allocation.
+        uint64_t reused{};
+        uint64_t allocated{};
+
+        /// Releases retained by the pool or discarded (small or over limit).
+        uint64_t retained{};
+        uint64_t discarded{};
+
+        /// Buffers and bytes (capacity) currently held by the pool.
+        size_t buffers{};
+        size_t bytes{};
+    };
+
+    DELETE_COPY_MOVE(buffer_pool);
+
+    /// Retains up to limit bytes of released buffer capacity.
+    buffer_pool(size_t limit=default_limit) NOEXCEPT;
+
+    /// The process-wide pool.
+    static buffer_pool& get() NOEXCEPT;
+
+    /// Resize buffer to size, exchanging it for a pooled buffer (or a new one
+    /// of the size class) when its capacity is insufficient.
+    void fit(system::data_chunk& buffer, size_t size) NOEXCEPT;
+
+    /// Release the buffer to its size class (buffer is left empty).
+    void release(system::data_chunk& buffer) NOEXCEPT;
+
+    /// Current pool statistics.
+    statistics stats() const NOEXCEPT;
+
+private:
+    using slab = std::vector<system::data_chunk>;
+
+    const size_t limit_;
+
+    // These are protected by mutex.
+    mutable std::mutex mutex_{};
+    std::array<slab, classes> slabs_{};
+    statistics stats_{};
+};
+
 } // namespace network
 } // namespace libbitcoin
 
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <span>
+#include <vector>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/messages/peer/heading.hpp>
 #include <bitcoin/network/messages/rpc/model.hpp>
@@ -43,16 +44,19 @@ struct BCT_API body
         bool checksum{};
         size_t maximum{};
 
+        /// Retain relayable payloads, deserialized upon access (see lazy).
+        bool relay{};
+
         /// Parse fault detail (read out).
         code fault{};
 
         /// Parsed message heading (read out).
         heading head{};
 
-        /// Type-erased deserialized message (read out).
+        /// Type-erased deserialized message, or lazy if relay (read out).
         rpc::any_t payload{};
 
-        /// Type-erased message with its registry index (write in).
+        /// Type-erased message (or lazy) with its registry index (write in).
         rpc::any_t message{};
         size_t index{};
 
@@ -98,10 +102,11 @@ struct BCT_API body
         value_type& value_;
 
         // Parse source, null when constructed without a caller buffer (put).
-        const system::data_chunk* payload_{};
+        // A message that owns its payload (block) takes the caller buffer.
+        system::data_chunk* payload_{};
 
     private:
-        bool accept(const std::span<const uint8_t>& payload,
+        bool accept(const std::span<const uint8_t>& payload, bool take,
             boost_code& ec) NOEXCEPT;
 
         size_t need_{};
@@ -142,6 +147,7 @@ struct BCT_API body
 using frame = body::value_type;
 using frame_ptr = std::shared_ptr<frame>;
 using frame_cptr = std::shared_ptr<const frame>;
+using frame_ptrs = std::vector<frame_ptr>;
 
 } // namespace peer
 } // namespace messages
@@ -42,6 +42,10 @@ struct BCT_API block
 
     static cptr deserialize(uint32_t version, const std::span<const uint8_t>& data,
         bool witness=true) NOEXCEPT;
+
+    /// The block view takes ownership of the payload (no copy).
+    static cptr deserialize(uint32_t version, system::data_chunk&& data,
+        bool witness=true) NOEXCEPT;
     static block deserialize(uint32_t version, system::reader& source,
         bool witness=true) NOEXCEPT;
 
@@ -40,6 +40,7 @@ struct BCT_API headers
     static const uint32_t version_maximum;
     static const std::string command;
 
+    /// Headers are allocated as one block, header pointers alias into it.
     static cptr deserialize(uint32_t version,
         const std::span<const uint8_t>& data) NOEXCEPT;
     static headers deserialize(uint32_t version,
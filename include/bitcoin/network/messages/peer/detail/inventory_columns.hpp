@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_MESSAGES_PEER_INVENTORY_COLUMNS_HPP
+#define LIBBITCOIN_NETWORK_MESSAGES_PEER_INVENTORY_COLUMNS_HPP
+
+#include <memory>
+#include <span>
+#include <bitcoin/network/define.hpp>
+#include <bitcoin/network/messages/peer/detail/inventory_item.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace messages {
+namespace peer {
+
+/// Inventory vectors as columns (structure of arrays), the layout of a
+/// retained relay inv payload (see lazy::to_columns). This is relay only, as
+/// getdata and notfound are not retained (see lazy::relayable), and inventory,
+/// get_data and not_found keep their items (and queries) as parsed. Types are
+/// compared four per instruction where supported (sse2), and hashes are
+/// contiguous, usable in place. Only type queries over the columns are
+/// provided, for any other query convert to_items (or use lazy::get).
+struct BCT_API inventory_columns
+{
+    typedef std::shared_ptr<const inventory_columns> cptr;
+    typedef inventory_item::type_id type_id;
+    typedef std::span<const system::hash_digest> hash_span;
+
+    static inventory_columns factory(const inventory_items& items) NOEXCEPT;
+
+    /// Deserialize the payload in one pass (no inventory_item construction).
+    static cptr deserialize(uint32_t version,
+        const std::span<const uint8_t>& data) NOEXCEPT;
+    static inventory_columns deserialize(uint32_t version,
+        system::reader& source) NOEXCEPT;
+
+    bool serialize(uint32_t version,
+        const system::data_slab& data) const NOEXCEPT;
+    void serialize(uint32_t version,
+        system::writer& sink) const NOEXCEPT;
+
+    size_t size(uint32_t version) const NOEXCEPT;
+
+    /// Row access and conversion to inventory items.
+    size_t rows() const NOEXCEPT;
+    inventory_item at(size_t row) const NOEXCEPT;
+    inventory_items to_items() const NOEXCEPT;
+
+    /// All hashes (no copy), true if all rows are of the type (or empty).
+    /// A relay inv is commonly of one type, so view() is then its hashes.
+    hash_span view() const NOEXCEPT;
+    bool all(type_id type) const NOEXCEPT;
+
+    /// Hashes, count, or presence of rows of the type.
+    system::hashes to_hashes(type_id type) const NOEXCEPT;
+    size_t count(type_id type) const NOEXCEPT;
+    bool any(type_id type) const NOEXCEPT;
+
+    /// Columns are of equal length.
+    std_vector<type_id> types;
+    system::hashes hashes;
+};
+
+} // namespace peer
+} // namespace messages
+} // namespace network
+} // namespace libbitcoin
+
+#endif
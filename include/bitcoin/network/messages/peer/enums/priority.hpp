@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_MESSAGES_PEER_ENUMS_PRIORITY_HPP
+#define LIBBITCOIN_NETWORK_MESSAGES_PEER_ENUMS_PRIORITY_HPP
+
+#include <bitcoin/network/define.hpp>
+#include <bitcoin/network/messages/peer/enums/identifiers.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace messages {
+namespace peer {
+
+/// Write queue class of a message, a higher class (lower value) is written
+/// first at frame boundaries, subject to starvation protection.
+enum class priority : uint8_t
+{
+    /// Handshake, keepalive, flow control and requests, and headers and
+    /// compact blocks, so that these are not queued behind blocks.
+    control = 0,
+
+    /// Announcements of transactions, blocks and addresses (inventory and
+    /// address), the only droppable class (see is_droppable).
+    announce = 1,
+
+    /// Blocks, transactions, filters and notfound (responses to requests).
+    /// A notfound shares the class of the responses it completes, so that it
+    /// cannot overtake the preceding responses to the same request.
+    bulk = 2
+};
+
+/// True if a queued message of the class may be dropped under backpressure.
+/// Only announcements are droppable, as a peer recovers them from subsequent
+/// announcements, whereas responses and control messages are required.
+constexpr bool is_droppable(priority level) NOEXCEPT
+{
+    return level == priority::announce;
+}
+
+/// Default write priority of a message, by its (v2) identifier. Messages
+/// without an identifier are handshake (version, verack) or otherwise small.
+constexpr priority to_priority(uint8_t identifier) NOEXCEPT
+{
+    switch (identifier)
+    {
+        case identifiers::address:
+        case identifiers::address_v2:
+        case identifiers::inventory:
+            return priority::announce;
+        case identifiers::block:
+        case identifiers::client_filter:
+        case identifiers::client_filter_checkpoint:
+        case identifiers::client_filter_headers:
+        case identifiers::compact_transactions:
+        case identifiers::merkle_block:
+        case identifiers::not_found:
+        case identifiers::transaction:
+            return priority::bulk;
+        default:
+            return priority::control;
+    }
+}
+
+} // namespace peer
+} // namespace messages
+} // namespace network
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_MESSAGES_PEER_LAZY_HPP
+#define LIBBITCOIN_NETWORK_MESSAGES_PEER_LAZY_HPP
+
+#include <memory>
+#include <mutex>
+#include <span>
+#include <bitcoin/network/define.hpp>
+#include <bitcoin/network/messages/peer/heading.hpp>
+#include <bitcoin/network/messages/peer/detail/inventory_columns.hpp>
+#include <bitcoin/network/messages/rpc/model.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace messages {
+namespace peer {
+
+/// A validated message payload retained as read, with its heading and parse
+/// context. The message is deserialized only upon first access, and the
+/// payload is sent as read (not reserialized) when the context matches.
+/// Thread safe (may be shared across channels for relay).
+class BCT_API lazy
+{
+public:
+    typedef std::shared_ptr<const lazy> cptr;
+
+    /// True if the registered message may be retained (tx, inv, addr).
+    static bool relayable(size_t index) NOEXCEPT;
+
+    /// True if the relayable payload is structurally valid and exactly
+    /// consumed in the context (sizes are walked, nothing is allocated).
+    static bool structured(size_t index, const std::span<const uint8_t>& data,
+        uint32_t version, bool witness) NOEXCEPT;
+
+    lazy(const heading& head, size_t index, system::chunk_cptr&& payload,
+        uint32_t version, bool witness) NOEXCEPT;
+
+    /// Parse context and retained payload.
+    const heading& head() const NOEXCEPT;
+    size_t index() const NOEXCEPT;
+    const system::chunk_cptr& payload() const NOEXCEPT;
+    uint32_t version() const NOEXCEPT;
+    bool witness() const NOEXCEPT;
+
+    /// The payload serialization is unchanged in the given context.
+    /// Witness must always match, version must match only for address.
+    bool reusable(uint32_t version, bool witness=true) const NOEXCEPT;
+
+    /// Serialize the v1 frame of the retained payload (heading is computed).
+    system::chunk_ptr to_frame(uint32_t magic) const NOEXCEPT;
+
+    /// The deserialized message, parsed once upon first access.
+    /// Returns nullptr if Message is not the retained type or is invalid.
+    template <class Message>
+    inline typename Message::cptr get() const NOEXCEPT
+    {
+        return message().get<const Message>();
+    }
+
+    /// The retained inventory as columns, parsed from the payload upon each
+    /// call (not the message). Returns nullptr if not inventory or invalid.
+    inventory_columns::cptr to_columns() const NOEXCEPT;
+
+    /// The deserialized message as registered, parsed once upon first access.
+    /// Has no value if the payload is invalid.
+    const rpc::any_t& message() const NOEXCEPT;
+
+private:
+
+    // These are thread safe.
+    const heading head_;
+    const size_t index_;
+    const system::chunk_cptr payload_;
+    const uint32_t version_;
+    const bool witness_;
+
+    // These are protected by mutex.
+    mutable std::mutex mutex_{};
+    mutable rpc::any_t message_{};
+    mutable bool parsed_{};
+};
+
+} // namespace peer
+} // namespace messages
+} // namespace network
+} // namespace libbitcoin
+
+#endif
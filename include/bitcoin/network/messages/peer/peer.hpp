@@ -35,6 +35,7 @@
 #include <bitcoin/network/messages/peer/detail/compact_transactions.hpp>
 #include <bitcoin/network/messages/peer/enums/level.hpp>
 #include <bitcoin/network/messages/peer/enums/magic_numbers.hpp>
+#include <bitcoin/network/messages/peer/enums/priority.hpp>
 #include <bitcoin/network/messages/peer/enums/service.hpp>
 #include <bitcoin/network/messages/peer/detail/fee_filter.hpp>
 #include <bitcoin/network/messages/peer/detail/get_address.hpp>
@@ -47,6 +48,7 @@
 #include <bitcoin/network/messages/peer/detail/get_headers.hpp>
 #include <bitcoin/network/messages/peer/detail/headers.hpp>
 #include <bitcoin/network/messages/peer/detail/inventory.hpp>
+#include <bitcoin/network/messages/peer/detail/inventory_columns.hpp>
 #include <bitcoin/network/messages/peer/detail/inventory_item.hpp>
 #include <bitcoin/network/messages/peer/detail/memory_pool.hpp>
 #include <bitcoin/network/messages/peer/detail/merkle_block.hpp>
@@ -63,6 +65,7 @@
 #include <bitcoin/network/messages/peer/detail/witness_tx_id_relay.hpp>
 #include <bitcoin/network/messages/peer/body.hpp>
 #include <bitcoin/network/messages/peer/heading.hpp>
+#include <bitcoin/network/messages/peer/lazy.hpp>
 #include <bitcoin/network/messages/peer/message.hpp>
 
 #endif
@@ -55,6 +55,9 @@ public:
     /// True if the method name is defined by the interface.
     static bool contains(const std::string& method) NOEXCEPT;
 
+    /// True if the method has a subscriber (false if not defined).
+    bool subscribed(const std::string& method) const NOEXCEPT;
+
     /// Dispatch request to subscribed method handler(s).
     virtual inline code notify(const request_t& request) NOEXCEPT;
 
@@ -134,6 +137,21 @@ private:
     /// Static map of handlers to functors.
     static const notifiers_t notifiers_;
 
+    /// make_emptiers
+    /// -----------------------------------------------------------------------
+private:
+    using emptier_t = bool(*)(const dispatcher&);
+    using emptiers_t = std::unordered_map<std::string, emptier_t>;
+
+    template <size_t Index>
+    static inline bool empty(const dispatcher& self) NOEXCEPT;
+    template <size_t ...Index>
+    static inline emptiers_t make_emptiers(
+        std::index_sequence<Index...>) NOEXCEPT;
+
+    /// Static map of handlers to subscriber emptiness.
+    static const emptiers_t emptiers_;
+
 protected:
     template <typename Method>
     static inline auto preamble(const code& ec=error::success) NOEXCEPT;
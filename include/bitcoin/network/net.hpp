@@ -27,6 +27,7 @@
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/log/log.hpp>
+#include <bitcoin/network/memory.hpp>
 #include <bitcoin/network/messages/messages.hpp>
 #include <bitcoin/network/net/net.hpp>
 #include <bitcoin/network/sessions/sessions.hpp>
@@ -117,6 +118,15 @@ public:
     /// The strand is running in this thread.
     bool stranded() const NOEXCEPT;
 
+    /// Global read budget, with its deferral counters (null if unlimited).
+    const ingress::ptr& read_budget() const NOEXCEPT;
+
+    /// Global write queue accounting (null if unlimited).
+    const congestion::ptr& write_backlog() const NOEXCEPT;
+
+    /// Statistics of the process-wide (shared) read buffer pool.
+    buffer_pool::statistics buffer_statistics() const NOEXCEPT;
+
     /// Subscriptions.
     /// -----------------------------------------------------------------------
     /// A channel pointer should only be retained when subscribed to its stop,
@@ -228,7 +238,7 @@ protected:
     virtual connectors_ptr create_connectors(size_t count) NOEXCEPT;
     virtual connector::ptr create_connector(const settings::socks5& socks,
         const socket::parameters::duration& connect_timeout,
-        uint32_t maximum_request) NOEXCEPT;
+        uint32_t maximum_request, const socket::tuning& tuning) NOEXCEPT;
 
     /// Sequences.
     virtual void do_start(const result_handler& handler) NOEXCEPT;
@@ -331,6 +341,12 @@ private:
 
     // These are protected by strand.
     hosts hosts_;
+    resolver_cache::ptr resolutions_;
+
+    // These are thread safe (or null).
+    egress::ptr egress_;
+    ingress::ptr ingress_;
+    congestion::ptr congestion_;
     object_key keys_{};
     broadcaster broadcaster_{};
     stop_subscriber stop_subscriber_{};
@@ -34,6 +34,8 @@ namespace network {
 /// Not thread safe, virtual.
 /// Create inbound socket connections.
 /// Stop is thread safe and idempotent, may be called multiple times.
+/// Accepts are initiated on the strand and complete on an acceptor-owned
+/// strand, so that listeners sharing a port complete accepts in parallel.
 class BCT_API acceptor
   : public std::enable_shared_from_this<acceptor>, public reporter,
     protected tracker<acceptor>
@@ -90,6 +92,7 @@ protected:
     asio::context& service_;
     std::atomic_bool& suspended_;
     const parameters parameters_;
+    asio::strand shard_;
 
     // These are protected by strand.
     asio::acceptor acceptor_;
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_NET_CONGESTION_HPP
+#define LIBBITCOIN_NETWORK_NET_CONGESTION_HPP
+
+#include <atomic>
+#include <memory>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+/// Thread safe, non-virtual.
+/// Process-wide accounting of bytes queued for writing, shared by the
+/// channels of a network. At or above the high-water mark the network is
+/// congested, and channels drop announcement peer writes (see proxy). Beyond
+/// the maximum (if nonzero) the network is overflowed, and a channel whose
+/// write would exceed it is stopped (releasing its queue).
+class BCT_API congestion final
+{
+public:
+    DELETE_COPY_MOVE(congestion);
+
+    typedef std::shared_ptr<congestion> ptr;
+
+    /// High-water mark in bytes (nonzero), maximum in bytes (zero unlimited).
+    congestion(uint64_t high_water, uint64_t maximum=0) NOEXCEPT;
+
+    /// Account bytes queued by a channel.
+    void add(size_t bytes) NOEXCEPT;
+
+    /// Account bytes written (or discarded) by a channel.
+    void remove(size_t bytes) NOEXCEPT;
+
+    /// Adding the bytes would reach or exceed the high-water mark.
+    bool congested(size_t bytes=0) const NOEXCEPT;
+
+    /// Adding the bytes would exceed the maximum.
+    bool overflowed(size_t bytes) const NOEXCEPT;
+
+    /// Bytes currently queued by all channels.
+    uint64_t queued() const NOEXCEPT;
+
+    /// The high-water mark in bytes.
+    uint64_t high_water() const NOEXCEPT;
+
+    /// The maximum in bytes (zero unlimited).
+    uint64_t maximum() const NOEXCEPT;
+
+private:
+    // These are thread safe.
+    const uint64_t high_water_;
+    const uint64_t maximum_;
+    std::atomic<uint64_t> queued_{};
+};
+
+} // namespace network
+} // namespace libbitcoin
+
+#endif
@@ -21,11 +21,13 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 #include <bitcoin/network/async/async.hpp>
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/log/log.hpp>
 #include <bitcoin/network/net/deadline.hpp>
+#include <bitcoin/network/net/resolver_cache.hpp>
 #include <bitcoin/network/net/socket.hpp>
 
 namespace libbitcoin {
@@ -49,9 +51,11 @@ public:
     /// -----------------------------------------------------------------------
 
     /// Construct an instance.
+    /// The optional cache must be shared only by connectors of the strand.
     connector(const logger& log, asio::strand& strand,
         asio::context& service, std::atomic_bool& suspended,
-        parameters&& parameters) NOEXCEPT;
+        parameters&& parameters,
+        const resolver_cache::ptr& cache={}) NOEXCEPT;
 
     /// Asserts/logs stopped.
     virtual ~connector() NOEXCEPT;
@@ -79,7 +83,25 @@ protected:
     typedef race_speed<two, const code&, const socket::ptr&> racer;
     typedef std::shared_ptr<bool> finish_ptr;
 
+    /// Staggered parallel connection attempts (rfc8305), protected by strand.
+    struct attempts
+    {
+        typedef std::shared_ptr<attempts> ptr;
+
+        socket::parameters parameters;
+        config::address address;
+        config::endpoint endpoint;
+        std::vector<asio::endpoint> points{};
+        std::vector<socket::ptr> sockets{};
+        deadline::ptr stagger{};
+        size_t started{};
+        size_t failed{};
+        bool expired{};
+        bool done{};
+    };
+
     /// Try to connect to host:port, starts timer.
+    /// Numeric hosts are not resolved, hostnames are resolved via the cache.
     virtual void start(const std::string& hostname, uint16_t port,
         const config::address& address, const config::endpoint& endpoint,
         socket_handler&& handler) NOEXCEPT;
@@ -93,6 +115,10 @@ protected:
     /// Override to inform socket construction.
     virtual bool proxied() const NOEXCEPT;
 
+    /// Order a resolved range by alternating address family (rfc8305).
+    static std::vector<asio::endpoint> interleave(
+        const asio::endpoints& range) NOEXCEPT;
+
     /// Running in the strand.
     bool stranded() NOEXCEPT;
 
@@ -103,16 +129,34 @@ protected:
     const parameters parameters_;
 
     // These are protected by strand.
+    resolver_cache::ptr cache_;
     asio::resolver resolver_;
     deadline::ptr timer_;
+    attempts::ptr attempts_{};
     racer racer_{};
 
 private:
+    void handle_lookup(const boost_code& ec, const asio::endpoints& range,
+        const std::string& hostname, uint16_t port, const finish_ptr& finish,
+        const socket::ptr& socket) NOEXCEPT;
     void handle_resolve(const boost_code& ec,
         const asio::endpoints& range, const finish_ptr& finish,
         const socket::ptr& socket) NOEXCEPT;
     void do_handle_connect(const code& ec, const finish_ptr& finish,
         const socket::ptr& socket) NOEXCEPT;
+
+    // Staggered connect.
+    void do_attempt(const attempts::ptr& state, const finish_ptr& finish,
+        const socket::ptr& primary) NOEXCEPT;
+    void handle_stagger(const code& ec, const attempts::ptr& state,
+        const finish_ptr& finish, const socket::ptr& primary) NOEXCEPT;
+    void do_handle_attempt(const code& ec, const attempts::ptr& state,
+        const finish_ptr& finish, const socket::ptr& primary,
+        const socket::ptr& attempt) NOEXCEPT;
+    void handle_attempt(const code& ec, const attempts::ptr& state,
+        const finish_ptr& finish, const socket::ptr& primary,
+        const socket::ptr& attempt) NOEXCEPT;
+    void stop_attempts() NOEXCEPT;
 };
 
 typedef std_vector<connector::ptr> connectors;
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_NET_EGRESS_HPP
+#define LIBBITCOIN_NETWORK_NET_EGRESS_HPP
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+/// Thread safe, non-virtual.
+/// Process-wide egress scheduler, shared by the channels of a network.
+/// A global rate (bytes/second) is divided among the channels that have sent
+/// within the activity window, in proportion to the weight of each channel's
+/// service (inbound, outbound, manual, each server). Each channel is a token
+/// bucket at its share, with one second of burst (and starting full), so that
+/// one channel cannot consume the share of another of the same service. The
+/// sum of active weights is maintained as channels become active, go idle, or
+/// are released, so a charge is constant time. A charge returns the
+/// period by which the channel's next send is deferred (as with the channel
+/// rate limit), so an idle channel yields its share and a busy one waits.
+class BCT_API egress final
+{
+public:
+    DELETE_COPY_MOVE(egress);
+
+    typedef std::shared_ptr<egress> ptr;
+    static constexpr auto window = std::chrono::seconds(1);
+
+    /// Rate in bytes per second (nonzero).
+    egress(uint32_t rate) NOEXCEPT;
+
+    /// Charge sent bytes to the channel at the weight of its service (zero is
+    /// treated as one), obtain the resulting send deferral.
+    steady_clock::duration charge(uint64_t channel, uint32_t weight,
+        size_t bytes) NOEXCEPT;
+
+    /// Release the bucket of a stopped channel.
+    void release(uint64_t channel) NOEXCEPT;
+
+    /// The global rate in bytes per second.
+    uint32_t rate() const NOEXCEPT;
+
+private:
+    struct bucket
+    {
+        uint32_t weight{};
+        bool counted{};
+        double tokens{};
+        steady_clock::time_point refill{};
+        steady_clock::time_point active{};
+    };
+
+    struct expiry
+    {
+        uint64_t channel{};
+        steady_clock::time_point active{};
+    };
+
+    void expire(const steady_clock::time_point& now) NOEXCEPT;
+
+    // This is thread safe.
+    const uint32_t rate_;
+
+    // These are protected by mutex.
+    std::unordered_map<uint64_t, bucket> buckets_{};
+    std::deque<expiry> expiries_{};
+    uint64_t weights_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace network
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_NET_INGRESS_HPP
+#define LIBBITCOIN_NETWORK_NET_INGRESS_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+/// Thread safe, non-virtual.
+/// Process-wide read budget, shared by the channels of a network. A token
+/// bucket at the global rate (bytes/second), with one second of burst. A
+/// charge returns the period by which the channel's next read is deferred,
+/// and the deferrals are counted for reporting.
+class BCT_API ingress final
+{
+public:
+    DELETE_COPY_MOVE(ingress);
+
+    typedef std::shared_ptr<ingress> ptr;
+
+    /// Rate in bytes per second (nonzero).
+    ingress(uint32_t rate) NOEXCEPT;
+
+    /// Charge read bytes to the budget, obtain the resulting read deferral.
+    steady_clock::duration charge(size_t bytes) NOEXCEPT;
+
+    /// The global rate in bytes per second.
+    uint32_t rate() const NOEXCEPT;
+
+    /// The number of charges that resulted in a deferral.
+    uint64_t deferrals() const NOEXCEPT;
+
+    /// The sum of the deferrals returned by charges.
+    steady_clock::duration deferred() const NOEXCEPT;
+
+private:
+    // These are thread safe.
+    const uint32_t rate_;
+    std::atomic<uint64_t> deferrals_{};
+    std::atomic<steady_clock::rep> deferred_{};
+
+    // These are protected by mutex.
+    double tokens_;
+    steady_clock::time_point refill_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace network
+} // namespace libbitcoin
+
+#endif
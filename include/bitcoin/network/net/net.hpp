@@ -20,12 +20,17 @@
 #define LIBBITCOIN_NETWORK_NET_NET_HPP
 
 #include <bitcoin/network/net/acceptor.hpp>
+#include <bitcoin/network/net/congestion.hpp>
 #include <bitcoin/network/net/connector.hpp>
 #include <bitcoin/network/net/connector_socks.hpp>
 #include <bitcoin/network/net/deadline.hpp>
+#include <bitcoin/network/net/egress.hpp>
 #include <bitcoin/network/net/hosts.hpp>
+#include <bitcoin/network/net/ingress.hpp>
 #include <bitcoin/network/net/proxy.hpp>
+#include <bitcoin/network/net/resolver_cache.hpp>
 #include <bitcoin/network/net/socket.hpp>
+#include <bitcoin/network/net/tuning.hpp>
 
 // The network classes are entirely lock free.
 
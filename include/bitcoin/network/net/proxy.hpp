@@ -19,10 +19,12 @@
 #ifndef LIBBITCOIN_NETWORK_NET_PROXY_HPP
 #define LIBBITCOIN_NETWORK_NET_PROXY_HPP
 
+#include <array>
 #include <atomic>
 #include <deque>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <bitcoin/network/async/async.hpp>
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
@@ -41,11 +43,27 @@ namespace network {
 /// Completion handler is invoked once write is complete, at which point the
 /// next queued write is invoked. When a channel stops with pending writes the
 /// write queue is purged without invoke of the purged handlers.
+/// Peer writes are queued by priority class (control, announce, bulk), and
+/// the highest class with a queued write goes next, at frame boundaries. A
+/// lower class that has been passed over repeatedly takes the next turn, so
+/// that bulk traffic is not starved. Order is preserved within each class.
+/// Consecutive queued peer frames of a class are coalesced into one write (up
+/// to a byte budget), scatter/gather for v1 and one buffer of consecutive
+/// encrypted packets for v2, with each handler invoked in order with its own
+/// bytes. Bytes of queued peer writes are accounted per channel and
+/// across the network (congestion socket parameter). At a high-water mark
+/// announcements are dropped (handler invoked with error::write_dropped) and
+/// the channel reports congested(), and beyond the channel or network maximum
+/// it is stopped. Other classes are not dropped, only bounded by the maximum.
 /// Each send is allocated (bytes/rate_limit) of time, and its completion is
 /// deferred by whatever portion of that allocation the write did not consume.
 /// Since nothing is produced until the completion handler is invoked, this
-/// throttles the channel without queueing. Reads are not metered, as they are
-/// bounded by protocol correctness. Zero rate_limit disables the throttle.
+/// throttles the channel without queueing. Zero rate_limit disables the
+/// throttle. An egress scheduler (socket parameter) applies the same deferral
+/// to share a global rate among channels, the longer of the two applies.
+/// Reads are optionally budgeted, per channel (read_limit) and globally (the
+/// ingress socket parameter). A read that overdraws either budget defers the
+/// next read of the channel until the debt is repaid (see deferred()).
 class BCT_API proxy
   : public enable_shared_from_base<proxy>, public reporter
 {
@@ -113,6 +131,22 @@ public:
     /// The total number of bytes queued/sent to the remote endpoint.
     uint64_t total() const NOEXCEPT;
 
+    /// The number of reads deferred by the channel or global read budget.
+    uint64_t deferrals() const NOEXCEPT;
+
+    /// The sum of the read deferrals of the channel.
+    steady_clock::duration deferred() const NOEXCEPT;
+
+    /// The bytes of peer messages queued for writing.
+    uint64_t queued() const NOEXCEPT;
+
+    /// The number of peer writes dropped at the high-water mark.
+    uint64_t dropped() const NOEXCEPT;
+
+    /// Queued writes are at the channel or network high-water mark, so that
+    /// optional writes (e.g. relay) should be deferred or skipped by senders.
+    bool congested() const NOEXCEPT;
+
     /// Get the address of the outgoing endpoint passed via construct.
     const config::address& address() const NOEXCEPT;
 
@@ -120,7 +154,9 @@ public:
     const config::endpoint& endpoint() const NOEXCEPT;
 
 protected:
-    proxy(const socket::ptr& socket, uint32_t rate_limit) NOEXCEPT;
+    proxy(const socket::ptr& socket, uint32_t rate_limit,
+        uint32_t read_limit=0, size_t high_water=0,
+        size_t maximum=0) NOEXCEPT;
 
     /// Accept a websocket upgrade request (requires strand).
     code accept_websocket(const http::request& request) NOEXCEPT;
@@ -143,6 +179,16 @@ protected:
     steady_clock::duration unconsumed(size_t bytes,
         const steady_clock::time_point& start) const NOEXCEPT;
 
+    /// Deferral of the egress scheduler for sent bytes, charged to the bucket
+    /// of the channel. Zero if no scheduler (override to charge a bucket).
+    virtual steady_clock::duration scheduled(size_t bytes) NOEXCEPT;
+
+    /// Charge read bytes to the channel and global read budgets. False if
+    /// neither is overdrawn (handler discarded), otherwise the handler is
+    /// invoked once the debt is repaid, or with error upon stop. The caller
+    /// holds its read loop until then (requires strand).
+    bool deferred(size_t bytes, result_handler&& handler) NOEXCEPT;
+
     /// Wait.
     /// -----------------------------------------------------------------------
 
@@ -196,7 +242,10 @@ protected:
         messages::peer::frame& message, count_handler&& handler) NOEXCEPT;
 
     /// Write peer message to the socket (peer::serialize frame in body).
+    /// The message is queued in its priority class and accounted at its size
+    /// in bytes (see class notes).
     virtual void write(messages::peer::frame&& message,
+        messages::peer::priority level, size_t size,
         count_handler&& handler) NOEXCEPT;
 
     /// Write rpc response to the socket (json buffer in body).
@@ -223,7 +272,31 @@ protected:
 
 private:
     typedef std::function<void()> writer;
-    typedef std::deque<writer> queue;
+    typedef std::deque<writer> writers;
+
+    // A queued write, with its frame and handler if a coalescable peer write.
+    // Writes other than peer messages share the control class (in order).
+    struct job
+    {
+        writer call{};
+        messages::peer::frame_ptr frame{};
+        count_handler handler{};
+        messages::peer::priority level{};
+        size_t bytes{};
+    };
+
+    typedef std::deque<job> queue;
+
+    // The number of priority classes, one queue for each.
+    static constexpr size_t classes = 3;
+    typedef std::array<queue, classes> queues;
+
+    // Turns a queued class may be passed over before it is next written.
+    static constexpr size_t starvation_limit = 8;
+
+    // Limits on the coalescing of queued peer frames into one write.
+    static constexpr size_t gather_frames = 64;
+    static constexpr size_t gather_bytes = 256 * 1024;
 
     // For write buffering.
     void do_http_write(const http::response_ptr& response,
@@ -275,9 +348,22 @@ private:
     // Implement chunked write with result handler.
     void write() NOEXCEPT;
     void do_write(const writer& call) NOEXCEPT;
+    void do_enqueue(const job& item) NOEXCEPT;
+    bool pending() const NOEXCEPT;
+    queue& select() NOEXCEPT;
+
+    // Account queued bytes, dropping or stopping at the limits.
+    bool admit(const job& item) NOEXCEPT;
+    void release(size_t bytes) NOEXCEPT;
     void handle_write(const code& ec, size_t bytes,
         const count_handler& handler) NOEXCEPT;
 
+    // Coalesce queued peer frames into one write.
+    bool gather(const queue& jobs) NOEXCEPT;
+    void handle_gather(const code& ec, size_t bytes,
+        const std::vector<size_t>& sizes) NOEXCEPT;
+    size_t framed(messages::peer::frame& out) const NOEXCEPT;
+
     // Meter sent bytes and defer the completion by the unconsumed allocation.
     count_handler metered(count_handler&& handler) NOEXCEPT;
     void handle_metered(const code& ec, size_t bytes,
@@ -289,18 +375,35 @@ private:
     // Invoke reading() on strand.
     void do_reading() NOEXCEPT;
 
+    // Debt of the channel read budget, in repayment time.
+    steady_clock::duration overdrawn(size_t bytes) NOEXCEPT;
+    void handle_deferred(const code& ec,
+        const result_handler& handler) NOEXCEPT;
+
     // These are thread safe.
     std::atomic_bool paused_{ true };
     std::atomic<uint64_t> total_{};
+    std::atomic<uint64_t> deferrals_{};
+    std::atomic<steady_clock::rep> deferred_time_{};
+    std::atomic<uint64_t> queued_{};
+    std::atomic<uint64_t> dropped_{};
     const uint32_t rate_limit_;
+    const uint32_t read_limit_;
+    const size_t high_water_;
+    const size_t maximum_;
     socket::ptr socket_;
 
     // These are protected by strand.
     deadline::ptr throttle_;
+    deadline::ptr reader_;
+    steady_clock::time_point refill_;
+    double tokens_;
     stop_subscriber stop_subscriber_{};
     socket::http_parser_ptr parser_{};
-    queue deferred_{};
-    queue queue_{};
+    writers deferred_{};
+    queues queues_{};
+    std::array<size_t, classes> passed_{};
+    size_t current_{};
     bool parted_{};
     bool batched_{};
 };
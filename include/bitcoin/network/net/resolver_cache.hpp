@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_NET_RESOLVER_CACHE_HPP
+#define LIBBITCOIN_NETWORK_NET_RESOLVER_CACHE_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+/// Not thread safe, non-virtual (shared by connectors on the network strand).
+/// Retains hostname resolutions for a fixed lifetime, as the system resolver
+/// does not expose record TTLs. Numeric hosts are not resolved or cached.
+class BCT_API resolver_cache final
+{
+public:
+    DELETE_COPY_MOVE(resolver_cache);
+
+    typedef steady_clock::duration duration;
+    typedef std::shared_ptr<resolver_cache> ptr;
+    static constexpr size_t default_capacity = 1024;
+
+    /// Zero lifetime disables caching.
+    resolver_cache(const duration& lifetime,
+        size_t capacity=default_capacity) NOEXCEPT;
+
+    /// Parse a numeric (optionally bracketed ipv6) host, false if a name.
+    static bool to_endpoint(asio::endpoint& out, const std::string& host,
+        uint16_t port) NOEXCEPT;
+
+    /// Obtain an unexpired resolution of host:port, false if none.
+    bool find(asio::endpoints& out, const std::string& host,
+        uint16_t port) NOEXCEPT;
+
+    /// Retain a nonempty resolution of host:port for the cache lifetime.
+    void store(const std::string& host, uint16_t port,
+        const asio::endpoints& range) NOEXCEPT;
+
+    /// Number of retained resolutions (including expired).
+    size_t size() const NOEXCEPT;
+
+private:
+    typedef std::pair<std::string, uint16_t> key;
+
+    struct entry
+    {
+        asio::endpoints range;
+        steady_clock::time_point expiry;
+    };
+
+    void prune(const steady_clock::time_point& now) NOEXCEPT;
+
+    // These are thread safe.
+    const duration lifetime_;
+    const size_t capacity_;
+
+    // This is not thread safe.
+    std::map<key, entry> map_{};
+};
+
+} // namespace network
+} // namespace libbitcoin
+
+#endif
@@ -28,7 +28,11 @@
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/log/log.hpp>
+#include <bitcoin/network/net/congestion.hpp>
 #include <bitcoin/network/net/deadline.hpp>
+#include <bitcoin/network/net/egress.hpp>
+#include <bitcoin/network/net/ingress.hpp>
+#include <bitcoin/network/net/tuning.hpp>
 #include <bitcoin/network/privacy/context.hpp>
 #include <bitcoin/network/privacy/stream.hpp>
 
@@ -53,12 +57,21 @@ public:
         ref<const privacy::context>
     >;
 
+    /// Kernel socket options (see settings::tcp_server::socket_tuning).
+    using tuning = network::tuning;
+
     struct parameters
     {
         using duration = steady_clock::duration;
 
         duration connect_timeout{};
+        duration connect_stagger{};
         size_t maximum_request{};
+        size_t read_ahead{};
+        socket::tuning tuning{};
+        egress::ptr scheduler{};
+        ingress::ptr budget{};
+        congestion::ptr congestion{};
         socket::context context{};
     };
 
@@ -158,6 +171,12 @@ public:
     virtual void peer_write(messages::peer::frame&& message,
         count_handler&& handler) NOEXCEPT;
 
+    /// Write peer frames to the socket as one write, handler posted to socket
+    /// strand with the total of bytes written. Frames are serialized (v1) for
+    /// a gather write, or encrypted (v2) as consecutive packets of one buffer.
+    virtual void peer_write(const messages::peer::frame_ptrs& messages,
+        count_handler&& handler) NOEXCEPT;
+
     /// RPC (TCP: electrum/stratum_v1, WS: btcd).
     /// -----------------------------------------------------------------------
 
@@ -236,6 +255,15 @@ public:
     /// Get the strand of the socket.
     virtual asio::strand& strand() NOEXCEPT;
 
+    /// Get the egress scheduler of the socket (or null).
+    virtual const egress::ptr& scheduler() const NOEXCEPT;
+
+    /// Get the global read budget of the socket (or null).
+    virtual const ingress::ptr& budget() const NOEXCEPT;
+
+    /// Get the global write queue accounting of the socket (or null).
+    virtual const congestion::ptr& backlog() const NOEXCEPT;
+
     /// The strand is running in this thread.
     virtual bool stranded() const NOEXCEPT;
 
@@ -424,6 +452,8 @@ private:
     // connection
     void do_connect(const asio::endpoints& range,
         const result_handler& handler) NOEXCEPT;
+    void do_connect_next(const asio::endpoints& range, size_t index,
+        const result_handler& handler) NOEXCEPT;
     void do_handshake(const result_handler& handler) NOEXCEPT;
     void handle_detection(const boost_code& ec,
         const result_handler& handler) NOEXCEPT;
@@ -441,8 +471,14 @@ private:
     // peer
     void do_peer_read(size_t total, const peer_state::ptr& in,
         const count_handler& handler) NOEXCEPT;
+    void do_peer_fill(size_t total, const peer_state::ptr& in,
+        const count_handler& handler) NOEXCEPT;
     void do_peer_write(const messages::peer::frame_ptr& out,
         const count_handler& handler) NOEXCEPT;
+    void do_peer_gather(const messages::peer::frame_ptrs& out,
+        const count_handler& handler) NOEXCEPT;
+    void do_peer_batch(const messages::peer::frame_ptrs& out,
+        const count_handler& handler) NOEXCEPT;
 
     // body
     void do_body_read(boost_code ec, size_t total,
@@ -489,6 +525,9 @@ private:
     // connect/accept
     void handle_accept(boost_code ec,
         const result_handler& handler) NOEXCEPT;
+    void handle_connect_next(const boost_code& ec,
+        const asio::endpoints& range, size_t index,
+        const result_handler& handler) NOEXCEPT;
     void handle_connect(const boost_code& ec, const asio::endpoint& peer,
         const result_handler& handler) NOEXCEPT;
     void handle_handshake(const boost_code& ec,
@@ -504,10 +543,14 @@ private:
     void handle_peer_read(const code& ec, size_t size, size_t residue,
         size_t total, const peer_state::ptr& in,
         const count_handler& handler) NOEXCEPT;
+    void handle_peer_fill(const code& ec, size_t size, size_t total,
+        const peer_state::ptr& in, const count_handler& handler) NOEXCEPT;
     void handle_peer_read_encrypted(const boost_code& ec, uint8_t identifier,
         const std::string& command, const std::span<const uint8_t>& payload,
         const peer_state::ptr& in, const count_handler& handler) NOEXCEPT;
-
+    void handle_peer_gather(const code& ec, size_t size,
+        const messages::peer::frame_ptrs& out,
+        const count_handler& handler) NOEXCEPT;
 
     // rpc
     void handle_rpc_read(const code& ec, size_t bytes,
@@ -545,6 +588,11 @@ private:
     // utility
     // ------------------------------------------------------------------------
 
+    size_t drain(uint8_t* data, size_t size) NOEXCEPT;
+    template <typename Option>
+    void advise(const Option& option) NOEXCEPT;
+    void tune_buffers() NOEXCEPT;
+    void tune() NOEXCEPT;
     void logx(const std::string& context, const boost_code& ec) const NOEXCEPT;
 
 protected:
@@ -552,6 +600,11 @@ protected:
     const bool inbound_;
     const bool proxied_;
     const size_t maximum_;
+    const size_t read_ahead_;
+    const tuning tuning_;
+    const egress::ptr scheduler_;
+    const ingress::ptr budget_;
+    const congestion::ptr backlog_;
     asio::strand strand_;
     asio::context& service_;
     const context context_;
@@ -566,6 +619,9 @@ protected:
 
     // Retains the detection prefix for a v1 peer (see handle_detection).
     http::flat_buffer detection_{ privacy::stream::detection_size };
+
+    // Retains bytes read ahead of the current v1 peer frame (see peer_read).
+    http::flat_buffer ahead_;
 };
 
 typedef std::function<void(const code&, const socket::ptr&)> socket_handler;
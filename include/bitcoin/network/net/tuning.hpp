@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_NET_TUNING_HPP
+#define LIBBITCOIN_NETWORK_NET_TUNING_HPP
+
+#include <chrono>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+/// Kernel socket options, zero (false) retains the system default.
+struct tuning
+{
+    using seconds = std::chrono::seconds;
+    using milliseconds = std::chrono::milliseconds;
+
+    bool no_delay{};
+    size_t send_buffer{};
+    size_t receive_buffer{};
+    size_t unsent_low_water{};
+    seconds keepalive_idle{};
+    seconds keepalive_interval{};
+    size_t keepalive_probes{};
+    milliseconds user_timeout{};
+    size_t backlog{};
+    bool reuse_port{};
+    bool fast_open{};
+    size_t fast_open_queue{};
+};
+
+} // namespace network
+} // namespace libbitcoin
+
+#endif
@@ -22,6 +22,7 @@
 #include <optional>
 #include <span>
 #include <bitcoin/network/define.hpp>
+#include <bitcoin/network/privacy/keypool.hpp>
 
 namespace libbitcoin {
 namespace network {
@@ -29,9 +30,9 @@ namespace privacy {
 
 /// The bip324 (v2) transport (p2ps) session cipher.
 /// This is to be used only for ephemeral network session keys.
-/// Construction generates an ephemeral keypair. Once the peer key is known,
-/// initialize() derives the directional packet ciphers, garbage terminators
-/// and session identifier. Not thread safe.
+/// Construction generates (or takes a pooled) ephemeral keypair. Once the
+/// peer key is known, initialize() derives the directional packet ciphers,
+/// garbage terminators and session identifier. Not thread safe.
 class BCT_API cipher final
 {
 public:
@@ -57,6 +58,10 @@ public:
     /// Generate an ephemeral keypair for the session.
     cipher() NOEXCEPT;
 
+    /// Take a pre-generated ephemeral keypair for the session from the pool,
+    /// generating one only if the pool is empty (or null).
+    explicit cipher(const keypool::ptr& pool) NOEXCEPT;
+
     /// Construct from a given keypair (deterministic, for test vectors).
     cipher(const system::ec_secret& secret, const key& public_key) NOEXCEPT;
 
@@ -78,6 +83,10 @@ public:
         std::span<const uint8_t> aad, bool ignore,
         std::span<uint8_t> out) NOEXCEPT;
 
+    /// Encrypt a packet in place, packet = length + header + contents + tag,
+    /// where contents are already written at offset length + header.
+    void encrypt(std::span<uint8_t> packet, bool ignore) NOEXCEPT;
+
     /// Decrypt an encrypted packet length (advances the length cipher).
     size_t decrypt_length(std::span<const uint8_t> in) NOEXCEPT;
 
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_NETWORK_PRIVACY_CONTEXT_HPP
 
 #include <bitcoin/network/define.hpp>
+#include <bitcoin/network/privacy/keypool.hpp>
 
 namespace libbitcoin {
 namespace network {
@@ -32,6 +33,10 @@ struct BCT_API context
     /// The network magic (heading identifier), keys the v2 key derivation
     /// salt, the v1 detection prefix, and synthesized v1 headings.
     uint32_t identifier{};
+
+    /// Pre-generated session keypairs (or null). A keypair is generated on
+    /// the socket strand only when the pool is empty (or null).
+    keypool::ptr keys{};
 };
 
 } // namespace privacy
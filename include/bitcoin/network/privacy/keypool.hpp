@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NETWORK_PRIVACY_KEYPOOL_HPP
+#define LIBBITCOIN_NETWORK_PRIVACY_KEYPOOL_HPP
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace privacy {
+
+/// Thread safe, non-virtual.
+/// Pool of pre-generated bip324 (v2) ephemeral keypairs, so that the EC work
+/// of a session keypair is not performed on the socket strand. The pool is
+/// refilled by its own lowest priority thread when it falls to half of its
+/// capacity. Each keypair is removed (and wiped) when taken, never reused.
+class BCT_API keypool final
+{
+public:
+    DELETE_COPY_MOVE(keypool);
+
+    typedef std::shared_ptr<keypool> ptr;
+    typedef system::data_array<system::ec_ellswift_size> key;
+
+    /// Generate an ephemeral keypair from operating system entropy.
+    static void generate(system::ec_secret& secret, key& public_key) NOEXCEPT;
+
+    /// Start filling the pool to capacity (nonzero).
+    keypool(size_t capacity) NOEXCEPT;
+
+    /// Stop and join the refill thread.
+    ~keypool() NOEXCEPT;
+
+    /// Take a keypair in constant time, false if the pool is empty.
+    bool take(system::ec_secret& secret, key& public_key) NOEXCEPT;
+
+    /// The number of keypairs available.
+    size_t size() const NOEXCEPT;
+
+    /// The maximum number of keypairs held.
+    size_t capacity() const NOEXCEPT;
+
+private:
+    struct keypair
+    {
+        system::ec_secret secret{};
+        key public_key{};
+    };
+
+    void schedule() NOEXCEPT;
+    void refill() NOEXCEPT;
+
+    // These are thread safe.
+    const size_t capacity_;
+    std::atomic_bool refilling_{};
+    std::atomic_bool stopped_{};
+
+    // This is protected by mutex.
+    std::deque<keypair> keys_{};
+    mutable std::mutex mutex_{};
+
+    // This is thread safe (declared last, joined first).
+    threadpool pool_;
+};
+
+} // namespace privacy
+} // namespace network
+} // namespace libbitcoin
+
+#endif
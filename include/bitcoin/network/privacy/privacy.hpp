@@ -21,6 +21,7 @@
 
 #include <bitcoin/network/privacy/cipher.hpp>
 #include <bitcoin/network/privacy/context.hpp>
+#include <bitcoin/network/privacy/keypool.hpp>
 #include <bitcoin/network/privacy/stream.hpp>
 
 #endif
@@ -22,6 +22,8 @@
 #include <functional>
 #include <memory>
 #include <span>
+#include <string>
+#include <vector>
 #include <bitcoin/network/asio.hpp>
 #include <bitcoin/network/messages/peer/heading.hpp>
 #include <bitcoin/network/privacy/cipher.hpp>
@@ -48,8 +50,20 @@ public:
     using payload_t = std::span<const uint8_t>;
     typedef std::function<void(const boost_code&, uint8_t,
         const std::string&, const payload_t&)> message_handler;
+    typedef std::function<bool(const std::span<uint8_t>&)> payload_writer;
     using executor_type = asio::socket::executor_type;
 
+    /// A message written as one packet of a batch (see async_write_messages).
+    struct outgoing
+    {
+        uint8_t identifier{};
+        std::string command{};
+        size_t size{};
+        payload_writer writer{};
+    };
+
+    typedef std::vector<outgoing> outgoings;
+
     /// The size of the v1 detection prefix (magic and command padding).
     static constexpr size_t detection_size =
         sizeof(uint32_t) + messages::peer::heading::command_size;
@@ -58,8 +72,20 @@ public:
     static bool detected_v1(const std::span<const uint8_t>& prefix,
         uint32_t identifier) NOEXCEPT;
 
-    /// Assume ownership of the connected tcp socket.
-    stream(asio::socket&& socket, const context& context) NOEXCEPT;
+    /// The encrypted packet size of a message with the given payload size.
+    static constexpr size_t packet_size(uint8_t identifier,
+        size_t size) NOEXCEPT
+    {
+        using namespace system;
+        constexpr auto command = add1(messages::peer::heading::command_size);
+        return (is_zero(identifier) ? command : one) + size +
+            cipher::expansion;
+    }
+
+    /// Assume ownership of the connected tcp socket. Packets that fit within
+    /// read_ahead bytes are read in batches through a read-ahead buffer.
+    stream(asio::socket&& socket, const context& context,
+        size_t read_ahead=zero) NOEXCEPT;
 
     /// asio stream conventions (next_layer enables get_lowest_layer).
     executor_type get_executor() NOEXCEPT;
@@ -89,6 +115,19 @@ public:
     void async_write_message(uint8_t identifier, const std::string& command,
         const system::chunk_cptr& payload, io_handler&& handler) NOEXCEPT;
 
+    /// Write a message as one encrypted packet (v2 only), with the writer
+    /// serializing size payload bytes directly into the packet buffer, which
+    /// is then encrypted in place. The buffer is pooled and reused by writes.
+    void async_write_message(uint8_t identifier, const std::string& command,
+        size_t size, payload_writer&& writer, io_handler&& handler) NOEXCEPT;
+
+    /// Write messages as consecutive encrypted packets of one buffer, sent
+    /// with one socket write, handler invoked with the total bytes written.
+    /// All payloads are serialized before any packet is encrypted (in order),
+    /// so that a failed serialization sends nothing and leaves the cipher.
+    void async_write_messages(outgoings&& messages,
+        io_handler&& handler) NOEXCEPT;
+
 private:
     typedef std::function<void(const boost_code&)> pump_handler;
 
@@ -121,27 +160,54 @@ private:
         pump_handler&& handler) NOEXCEPT;
     void handle_read(const boost_code& ec, size_t size,
         const pump_handler& handler) NOEXCEPT;
+    void fill(pump_handler&& handler) NOEXCEPT;
+    void handle_fill(const boost_code& ec, size_t size,
+        const pump_handler& handler) NOEXCEPT;
+    size_t buffered() const NOEXCEPT;
+    size_t drain(const std::span<uint8_t>& out) NOEXCEPT;
+    void consume(size_t size) NOEXCEPT;
+
+    // packet read
+    void handle_length_ahead(const boost_code& ec,
+        system::data_chunk& buffer, size_t maximum,
+        const message_handler& handler) NOEXCEPT;
     void handle_message_length(const boost_code& ec,
         system::data_chunk& buffer, size_t maximum,
         const message_handler& handler) NOEXCEPT;
+    void read_packet(system::data_chunk& buffer, size_t length,
+        size_t maximum, const message_handler& handler) NOEXCEPT;
+    void handle_packet_ahead(const boost_code& ec,
+        system::data_chunk& buffer, size_t length, size_t maximum,
+        const message_handler& handler) NOEXCEPT;
     void handle_message_read(const boost_code& ec,
         system::data_chunk& buffer, size_t length, size_t maximum,
         const message_handler& handler) NOEXCEPT;
+    void handle_plain(bool ignore, const std::span<const uint8_t>& plain,
+        system::data_chunk& buffer, size_t maximum,
+        const message_handler& handler) NOEXCEPT;
     static bool split(uint8_t& identifier, std::string& command,
         size_t& prefix, const std::span<const uint8_t>& contents) NOEXCEPT;
 
     // packet write
+    static bool writable(uint8_t identifier, const std::string& command,
+        size_t size) NOEXCEPT;
+    static bool pack(const std::span<uint8_t>& packet, uint8_t identifier,
+        const std::string& command, const payload_writer& writer) NOEXCEPT;
     void handle_message_sent(const boost_code& ec, size_t size,
-        const system::chunk_ptr& packet, const io_handler& handler) NOEXCEPT;
+        const io_handler& handler) NOEXCEPT;
 
 
     // These are protected by stream (executor) sequencing.
-    cipher cipher_{};
+    cipher cipher_;
     asio::socket socket_;
     const uint32_t identifier_;
+    const size_t read_ahead_;
     system::data_chunk packet_{};
-    system::data_chunk residue_{};
+    system::data_chunk ahead_{};
+    size_t ahead_start_{};
+    size_t ahead_end_{};
     system::data_chunk garbage_{};
+    system::data_chunk sending_{};
 };
 
 } // namespace privacy
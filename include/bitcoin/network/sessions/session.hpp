@@ -223,6 +223,10 @@ protected:
     /// The network strand.
     asio::strand& strand() NOEXCEPT;
 
+    /// The number of acceptors to open for each bind of the service.
+    virtual size_t acceptors(
+        const network::settings::tcp_server& options) const NOEXCEPT;
+
 protected:
     virtual void handle_channel_starting(const code& ec,
         const channel::ptr& channel, const result_handler& started,
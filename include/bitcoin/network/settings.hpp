@@ -24,6 +24,7 @@
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/messages/messages.hpp>
+#include <bitcoin/network/net/tuning.hpp>
 
 #define BC_HTTP_SERVER_NAME "libbitcoin/4"
 
@@ -94,10 +95,56 @@ struct BCT_API settings
         /// settings::rate_limited). Zero is unlimited.
         uint32_t rate_limit{ 0 };
 
+        /// Relative share of the network egress limit of each channel of the
+        /// service (zero is treated as one).
+        uint32_t egress_weight{ 1 };
+
+        /// Bytes/second read by each peer channel of the service, zero is
+        /// unlimited. A read beyond the budget defers the next read.
+        uint32_t read_limit{ 0 };
+
+        /// Bytes queued for writing to each peer channel of the service. At
+        /// the high-water mark announcements are dropped and the channel is
+        /// congested (signaled to senders), beyond the maximum the channel is
+        /// stopped. Zero is unlimited.
+        uint32_t queue_high_water{ 0 };
+        uint32_t queue_maximum{ 0 };
+
+        /// Kernel socket options of accepted and connected sockets.
+        /// Zero (false) retains the system default, options unavailable on
+        /// the platform are ignored. Keepalive is enabled by a nonzero idle.
+        bool no_delay{ false };
+        uint32_t send_buffer{ 0 };
+        uint32_t receive_buffer{ 0 };
+        uint32_t unsent_low_water{ 0 };
+        uint32_t keepalive_idle_seconds{ 0 };
+        uint32_t keepalive_interval_seconds{ 0 };
+        uint32_t keepalive_probes{ 0 };
+        uint32_t user_timeout_milliseconds{ 0 };
+
+        /// Pending connection queue of each listener, zero is system maximum.
+        uint32_t listen_backlog{ 0 };
+
+        /// TCP Fast Open for connects (first write in the SYN) and listeners
+        /// (with the given pending queue). Requires kernel enablement (Linux
+        /// net.ipv4.tcp_fastopen), otherwise connections are normal. A fast
+        /// open connect completes before the handshake, so it applies only to
+        /// numeric hosts (such as pool addresses), which are then bounded by
+        /// the channel handshake timeout instead of the connect timeout. A
+        /// host that is resolved (such as a seed name) connects normally.
+        bool fast_open{ false };
+        uint32_t fast_open_queue{ 16 };
+
+        /// Listeners per bind, sharing the port by SO_REUSEPORT so that the
+        /// kernel spreads connections across them. Zero is one per thread,
+        /// always one where SO_REUSEPORT is not available.
+        uint16_t acceptors{ 1 };
+
         /// Helpers.
         virtual bool enabled() const NOEXCEPT;
         virtual steady_clock::duration inactivity() const NOEXCEPT;
         virtual steady_clock::duration expiration() const NOEXCEPT;
+        virtual network::tuning socket_tuning() const NOEXCEPT;
     };
 
     struct tls_server
@@ -315,19 +362,52 @@ struct BCT_API settings
     bool enable_reject{ false };
     bool enable_relay{ false };
     bool enable_privacy{ false };
+
+    /// Pre-generated bip324 session keypairs (with enable_privacy), zero
+    /// generates each keypair on the socket strand (see privacy::keypool).
+    uint32_t privacy_keypool{ 64 };
+
     bool validate_checksum{ false };
     uint32_t identifier{ 0 };
     uint32_t retry_timeout_seconds{ 1 };
     uint32_t connect_timeout_seconds{ 5 };
+
+    /// Delay before racing the next address of a multi-address host (rfc8305),
+    /// zero tries each address in sequence within the connect timeout.
+    uint32_t connect_stagger_milliseconds{ 250 };
     uint32_t handshake_timeout_seconds{ 15 };
     uint32_t channel_heartbeat_minutes{ 5 };
     uint32_t maximum_skew_minutes{ 120 };
 
+    /// Lifetime of outbound hostname resolutions, zero disables the cache.
+    uint32_t resolve_cache_seconds{ 60 };
+
     /// Bytes/second allocated to each channel for sending, zero is unlimited.
     /// A send is deferred by the unconsumed portion of its byte allocation,
     /// which the next send of the channel cannot start until it expires.
     /// Overlaps tcp_server::rate_limit (see settings::rate_limited).
     uint32_t rate_limit{ 0 };
+
+    /// Bytes/second sent by all channels, zero is unlimited. This is shared
+    /// among active channels, weighted by the tcp_server::egress_weight of
+    /// each channel's service (see egress).
+    uint32_t egress_limit{ 0 };
+
+    /// Bytes/second read by all peer channels, zero is unlimited. A read
+    /// beyond the budget defers the next read of the channel (see ingress).
+    uint32_t ingress_limit{ 0 };
+
+    /// Bytes queued for writing to all peer channels, zero is unlimited. At
+    /// the high-water mark announcements are dropped, and beyond the maximum
+    /// the channel of the write is stopped (see congestion). A zero high-water
+    /// mark with a nonzero maximum is set to the maximum.
+    uint32_t queue_high_water{ 0 };
+    uint32_t queue_maximum{ 0 };
+
+    /// Bytes read ahead of each peer message, zero disables buffering.
+    /// Frames (v1) or packets (v2) that fit are parsed from large reads.
+    uint32_t read_ahead{ 0 };
+
     std::string user_agent{ BC_USER_AGENT };
     std::filesystem::path path{};
     config::authorities blacklists{};
@@ -336,6 +416,8 @@ struct BCT_API settings
     /// Helpers.
     virtual steady_clock::duration retry_timeout() const NOEXCEPT;
     virtual steady_clock::duration connect_timeout() const NOEXCEPT;
+    virtual steady_clock::duration connect_stagger() const NOEXCEPT;
+    virtual steady_clock::duration resolve_cache() const NOEXCEPT;
     virtual steady_clock::duration channel_handshake() const NOEXCEPT;
     virtual steady_clock::duration channel_heartbeat() const NOEXCEPT;
     virtual steady_clock::duration maximum_skew() const NOEXCEPT;
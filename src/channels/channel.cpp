@@ -56,10 +56,12 @@ uint32_t channel::rate_limited(const settings_t& settings,
 channel::channel(const logger& log, const socket::ptr& socket,
     uint64_t identifier, const settings_t& settings,
     const options_t& options) NOEXCEPT
-  : proxy(socket, rate_limited(settings, options)),
+  : proxy(socket, rate_limited(settings, options), options.read_limit,
+        options.queue_high_water, options.queue_maximum),
     options_(options),
     settings_(settings),
     identifier_(identifier),
+    scheduler_(socket->scheduler()),
     inactivity_(make_timer(log, socket->strand(), options.inactivity())),
     expiration_(make_timer(log, socket->strand(), options.expiration()))
 {
@@ -80,6 +82,10 @@ void channel::stopping(const code& ec) NOEXCEPT
     BC_ASSERT(stranded());
     stop_expiration();
     stop_inactivity();
+
+    if (scheduler_)
+        scheduler_->release(identifier_);
+
     proxy::stopping(ec);
 }
 
@@ -122,9 +128,10 @@ void channel::handle_monitor(const code& ec) NOEXCEPT
 
 // Timers.
 // ----------------------------------------------------------------------------
-// Send throttling (settings.rate_limit) is implemented by the proxy. A channel
-// whose accrued deferral exceeds inactivity is dropped by that timer, which is
-// the intended outcome (the throttle degrades to disconnection under abuse).
+// Send throttling (settings.rate_limit) and read budgets are implemented by
+// the proxy. A channel whose accrued deferral exceeds inactivity is dropped by
+// that timer, which is the intended outcome (the throttle degrades to
+// disconnection under abuse).
 // A restarted timer invokes completion handler with error::operation_canceled.
 // Called from start or strand.
 
@@ -135,6 +142,15 @@ void channel::reading() NOEXCEPT
     start_inactivity();
 }
 
+// protected
+steady_clock::duration channel::scheduled(size_t bytes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    return scheduler_ ?
+        scheduler_->charge(identifier_, options_.egress_weight, bytes) :
+        steady_clock::duration{};
+}
+
 size_t channel::remaining() const NOEXCEPT
 {
     BC_ASSERT(stranded());
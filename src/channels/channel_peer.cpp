@@ -18,6 +18,7 @@
  */
 #include <bitcoin/network/channels/channel_peer.hpp>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -56,6 +57,7 @@ void channel_peer::stopping(const code& ec) NOEXCEPT
     // Post message handlers to strand and clear/stop accepting subscriptions.
     // On channel_stopped message subscribers should ignore and perform no work.
     dispatcher_.stop(ec);
+    relay_subscriber_.stop_default(ec);
 }
 
 void channel_peer::resume() NOEXCEPT
@@ -109,6 +111,7 @@ frame_ptr channel_peer::create_frame() const NOEXCEPT
     in->version = negotiated_version();
     in->checksum = settings().validate_checksum;
     in->maximum = options().maximum_request;
+    in->relay = !relay_subscriber_.empty();
     return in;
 }
 
@@ -165,6 +168,42 @@ address_item_cptr channel_peer::get_updated_address() const NOEXCEPT
     return peer;
 }
 
+// Relay (retained messages).
+// ----------------------------------------------------------------------------
+
+void channel_peer::subscribe_relay(relay_handler&& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    relay_subscriber_.subscribe(std::move(handler));
+}
+
+void channel_peer::send(const lazy::cptr& message,
+    result_handler&& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    using registry = rpc::peer_registry;
+
+    const auto index = message->index();
+    const auto& command = message->head().command;
+    const auto level = to_priority(registry::identifiers().at(index));
+
+    frame out{};
+    out.magic = settings().identifier;
+    out.version = negotiated_version();
+    out.message = rpc::any_t{ message };
+    out.index = index;
+
+    // Queued size is the v1 frame size of the retained payload.
+    const auto size = message->payload()->size();
+    LOGX("Relay " << command << " to [" << endpoint() << "] ("
+        << size << " bytes)");
+
+    write(std::move(out), level, heading::size() + size,
+        std::bind(&channel_peer::handle_send,
+            shared_from_base<channel_peer>(), _1, _2, command,
+            std::move(handler)));
+}
+
 // Read cycle (read continues until stop called).
 // ----------------------------------------------------------------------------
 
@@ -194,7 +233,7 @@ void channel_peer::receive() NOEXCEPT
 // Handle errors and post message to subscribers.
 // The frame object is allocated on another thread and destroyed on this one.
 // This introduces cross-thread allocation/deallocation, though size is small.
-void channel_peer::handle_receive(const code& ec, size_t,
+void channel_peer::handle_receive(const code& ec, size_t bytes,
     const frame_ptr& in) NOEXCEPT
 {
     BC_ASSERT(stranded());
@@ -219,36 +258,84 @@ void channel_peer::handle_receive(const code& ec, size_t,
 
     reading_ = false;
 
-    // Notify subscribers of the new message.
+    // Notify subscribers of the new message (relay subscribers if retained).
     // If object passes to another thread destruction cost is very high.
-    if (const auto code = dispatcher_.notify(rpc::request_t
-    {
-        .method = in->head.command,
-        .params = { rpc::array_t{ std::move(in->payload) } }
-    }))
+    if (const auto code = notify(*in))
     {
         stop(code);
         return;
     }
 
-    // Don't retain larger than configured when current (time-space tradeoff).
-    if (current() && payload_buffer_.capacity() > options().minimum_buffer)
+    // A message that owns its payload (block, relay) takes the buffer only if
+    // exactly sized (it copies a pooled buffer, so as not to pin its excess).
+    // Else a buffer larger than the smallest pool class (or the configured
+    // minimum) is returned to the shared pool, and the next read borrows one.
+    const auto retain = std::min<size_t>(options().minimum_buffer,
+        power2(buffer_pool::minimum_class));
+    if (payload_buffer_.capacity() > retain)
+        buffer_pool::get().release(payload_buffer_);
+
+    // An overdrawn read budget holds the loop (reading) until repaid, so that
+    // resume is idempotent and pause is honored when the loop restarts.
+    if (deferred(bytes, std::bind(&channel_peer::handle_deferred,
+        shared_from_base<channel_peer>(), _1)))
     {
-        payload_buffer_.resize(options().minimum_buffer);
-        payload_buffer_.shrink_to_fit();
+        reading_ = true;
+        return;
     }
 
     receive();
 }
 
+// A retained message is structurally valid (see body), and is parsed only for
+// dispatch to its message subscribers, if any. That parse precedes the relay
+// notification and is shared with relay subscribers by the retained instance.
+code channel_peer::notify(frame& in) NOEXCEPT
+{
+    if (const auto retained = in.payload.get<const lazy>())
+    {
+        if (!dispatcher_.subscribed(in.head.command))
+        {
+            relay_subscriber_.notify(error::success, retained);
+            return error::success;
+        }
+
+        in.payload = retained->message();
+        if (!in.payload)
+            return error::invalid_message;
+
+        relay_subscriber_.notify(error::success, retained);
+    }
+
+    return dispatcher_.notify(rpc::request_t
+    {
+        .method = in.head.command,
+        .params = { rpc::array_t{ std::move(in.payload) } }
+    });
+}
+
+void channel_peer::handle_deferred(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    reading_ = false;
+
+    // error::operation_canceled is set by stop.
+    if (stopped() || ec)
+        return;
+
+    receive();
+}
+
 void channel_peer::handle_send(const code& ec, size_t LOG_ONLY(size),
     const std::string& LOG_ONLY(command), const result_handler& handler) NOEXCEPT
 {
-    if (ec)
+    // A dropped (congested) write is reported to the sender only.
+    if (ec && ec != error::write_dropped)
         stop(ec);
 
     // Don't log common conditions.
     if (ec &&
+        ec != error::write_dropped &&
         ec != error::peer_disconnect &&
         ec != error::operation_canceled &&
         ec != error::connect_failed)
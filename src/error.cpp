@@ -58,6 +58,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { protocol_violation, "protocol violation" },
     { channel_overflow, "channel overflow" },
     { channel_underflow, "channel underflow" },
+    { write_dropped, "write dropped" },
 
     // incoming connection failures
     { listen_failed, "incoming connection failed" },
@@ -18,6 +18,9 @@
  */
 #include <bitcoin/network/memory.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
 #include <bitcoin/network/define.hpp>
 
 namespace libbitcoin {
@@ -32,5 +35,100 @@ arena* default_memory::get_arena() NOEXCEPT
     return default_arena::get();
 }
 
+// buffer_pool
+// ----------------------------------------------------------------------------
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+buffer_pool::buffer_pool(size_t limit) NOEXCEPT
+  : limit_(limit)
+{
+}
+
+buffer_pool& buffer_pool::get() NOEXCEPT
+{
+    static buffer_pool instance{};
+    return instance;
+}
+
+void buffer_pool::fit(data_chunk& buffer, size_t size) NOEXCEPT
+{
+    if (buffer.capacity() >= size)
+    {
+        buffer.resize(size);
+        return;
+    }
+
+    // Smallest class that holds size (not pooled above the largest class).
+    const auto exponent = std::max(ceilinged_log2(size), minimum_class);
+    if (exponent > maximum_class)
+    {
+        release(buffer);
+        buffer.resize(size);
+        return;
+    }
+
+    data_chunk out{};
+    {
+        std::unique_lock lock{ mutex_ };
+        auto& from = slabs_.at(exponent - minimum_class);
+        if (from.empty())
+        {
+            ++stats_.allocated;
+        }
+        else
+        {
+            out = std::move(from.back());
+            from.pop_back();
+            --stats_.buffers;
+            stats_.bytes -= out.capacity();
+            ++stats_.reused;
+        }
+    }
+
+    release(buffer);
+    out.reserve(power2(exponent));
+    out.resize(size);
+    buffer = std::move(out);
+}
+
+void buffer_pool::release(data_chunk& buffer) NOEXCEPT
+{
+    auto in = std::move(buffer);
+    buffer.clear();
+
+    // Largest class held by the capacity (capacities above the largest class
+    // are reused by it, and those below the smallest are not pooled).
+    const auto capacity = in.capacity();
+    if (is_zero(capacity))
+        return;
+
+    const auto exponent = floored_log2(capacity);
+    std::unique_lock lock{ mutex_ };
+    if (exponent < minimum_class ||
+        ceilinged_add(stats_.bytes, capacity) > limit_)
+    {
+        ++stats_.discarded;
+        return;
+    }
+
+    in.clear();
+    slabs_.at(std::min(exponent, maximum_class) - minimum_class)
+        .push_back(std::move(in));
+    ++stats_.buffers;
+    stats_.bytes += capacity;
+    ++stats_.retained;
+}
+
+buffer_pool::statistics buffer_pool::stats() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return stats_;
+}
+
+BC_POP_WARNING()
+
 } // namespace network
 } // namespace libbitcoin
@@ -49,6 +49,30 @@ static size_t set_fault(frame& value, const code& fault,
     return zero;
 }
 
+// A relayable payload is retained as read when structurally valid (not
+// deserialized). Otherwise it is deserialized as any message, and so faults
+// if invalid. Relay subscribers are thereby never issued malformed payloads.
+static bool is_retained(const frame& value, size_t index,
+    const std::span<const uint8_t>& payload) NOEXCEPT
+{
+    return value.relay && lazy::relayable(index) && lazy::structured(index,
+        payload, value.version, value.witness);
+}
+
+// A retained payload takes the caller buffer when given and exactly sized,
+// otherwise copies. A buffer with excess (pooled) capacity is not taken, as
+// the message would pin that capacity for its lifetime.
+static rpc::any_t to_lazy(const frame& value, size_t index,
+    const std::span<const uint8_t>& payload, data_chunk* buffer) NOEXCEPT
+{
+    auto data = is_null(buffer) || buffer->capacity() > buffer->size() ?
+        to_shared<data_chunk>(payload.begin(), payload.end()) :
+        to_shared<data_chunk>(std::move(*buffer));
+
+    return rpc::any_t{ lazy::cptr{ to_shared<lazy>(value.head, index,
+        std::move(data), value.version, value.witness) } };
+}
+
 void body::reader::init(const http::length_type&, boost_code& ec) NOEXCEPT
 {
     need_ = heading::size();
@@ -65,8 +89,10 @@ size_t body::reader::need() const NOEXCEPT
 
 // private
 bool body::reader::accept(const std::span<const uint8_t>& payload,
-    boost_code& ec) NOEXCEPT
+    bool take, boost_code& ec) NOEXCEPT
 {
+    using registry = rpc::peer_registry;
+
     if (value_.checksum && value_.head.checksum !=
         network_checksum(bitcoin_hash(payload.size(), payload.data())))
     {
@@ -74,8 +100,16 @@ bool body::reader::accept(const std::span<const uint8_t>& payload,
         return false;
     }
 
-    value_.payload = rpc::peer_registry::to_any(value_.head.index(), payload,
-        value_.version, value_.witness);
+    // The caller buffer holds exactly the payload, so it may be handed off.
+    const auto index = value_.head.index();
+    if (is_retained(value_, index, payload))
+        value_.payload = to_lazy(value_, index, payload,
+            take ? payload_ : nullptr);
+    else
+        value_.payload = take ?
+            registry::to_any(index, std::move(*payload_), value_.version,
+                value_.witness) :
+            registry::to_any(index, payload, value_.version, value_.witness);
 
     if (!value_.payload)
     {
@@ -100,11 +134,14 @@ size_t body::reader::put(const buffer_type& buffer, boost_code& ec) NOEXCEPT
         if (size < need_)
             return zero;
 
-        // The payload is parsed in place (buffered by the caller either way).
-        const auto payload = is_null(payload_) ?
-            std::span<const uint8_t>{ data, need_ } :
-            std::span<const uint8_t>{ *payload_ };
-        return accept(payload, ec) ? value_.head.payload_size : zero;
+        // The payload is parsed in place (buffered by the caller either way),
+        // and an exactly sized caller buffer is taken by a message that owns
+        // its payload (a buffer with excess pooled capacity is copied).
+        const auto take = !is_null(payload_);
+        const auto payload = take ?
+            std::span<const uint8_t>{ *payload_ } :
+            std::span<const uint8_t>{ data, need_ };
+        return accept(payload, take, ec) ? value_.head.payload_size : zero;
     }
 
     // Heading.
@@ -129,7 +166,7 @@ size_t body::reader::put(const buffer_type& buffer, boost_code& ec) NOEXCEPT
     need_ = value_.head.payload_size;
 
     // An empty payload completes the message.
-    if (is_zero(need_) && !accept({}, ec))
+    if (is_zero(need_) && !accept({}, false, ec))
         return zero;
 
     return heading::size();
@@ -164,8 +201,9 @@ void body::reader::put(uint8_t identifier, const std::string& command,
         zero
     };
 
-    value_.payload = registry::to_any(index, payload, value_.version,
-        value_.witness);
+    value_.payload = is_retained(value_, index, payload) ?
+        to_lazy(value_, index, payload, nullptr) :
+        registry::to_any(index, payload, value_.version, value_.witness);
 
     if (!value_.payload)
     {
@@ -52,6 +52,19 @@ typename block::cptr block::deserialize(uint32_t version,
     return message->block.is_valid() ? message : nullptr;
 }
 
+// static
+typename block::cptr block::deserialize(uint32_t version, data_chunk&& data,
+    bool witness) NOEXCEPT
+{
+    if (version < version_minimum || version > version_maximum)
+        return {};
+
+    const auto message = emplace_shared<messages::peer::block>(
+        chain::block_view{ std::move(data), witness });
+
+    return message->block.is_valid() ? message : nullptr;
+}
+
 // static
 block block::deserialize(uint32_t version, reader& source,
     bool witness) NOEXCEPT
@@ -42,8 +42,8 @@ size_t bloom_filter_clear::size(uint32_t) NOEXCEPT
 typename bloom_filter_clear::cptr bloom_filter_clear::deserialize(
     uint32_t version, const std::span<const uint8_t>& data) NOEXCEPT
 {
-    system::istream source{ { data.begin(), data.end() } };
-    system::byte_reader reader{ source };
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
     const auto message = to_shared(deserialize(version, reader));
     return reader ? message : nullptr;
 }
@@ -39,8 +39,8 @@ const uint32_t client_filter_checkpoint::version_maximum = level::maximum_protoc
 typename client_filter_checkpoint::cptr client_filter_checkpoint::deserialize(
     uint32_t version, const std::span<const uint8_t>& data) NOEXCEPT
 {
-    system::istream source{ { data.begin(), data.end() } };
-    system::byte_reader reader{ source };
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
     const auto message = to_shared(deserialize(version, reader));
     return reader ? message : nullptr;
 }
@@ -20,6 +20,7 @@
 
 #include <iterator>
 #include <memory>
+#include <vector>
 #include <bitcoin/network/messages/peer/enums/level.hpp>
 #include <bitcoin/network/messages/peer/enums/magic_numbers.hpp>
 #include <bitcoin/network/messages/peer/detail/inventory_item.hpp>
@@ -39,46 +40,71 @@ const uint32_t headers::version_maximum = level::maximum_protocol;
 // Each header must trail a zero byte (yes, it's stoopid).
 constexpr uint8_t trail = 0x00;
 
+// Headers are read into one contiguous block (one allocation).
+static std::shared_ptr<std::vector<chain::header>> read_block(
+    uint32_t version, system::reader& source) NOEXCEPT
+{
+    if (version < headers::version_minimum ||
+        version > headers::version_maximum)
+        source.invalidate();
+
+    const auto count = source.read_size(max_get_headers);
+    const auto block = to_shared<std::vector<chain::header>>();
+    block->reserve(count);
+
+    for (size_t header = 0; header < count && source; ++header)
+    {
+        block->emplace_back(source);
+        if (source.read_byte() != trail)
+            source.invalidate();
+    }
+
+    return block;
+}
+
+// Each header pointer aliases its element, sharing ownership of the block.
+static chain::header_cptrs to_pointers(
+    const std::shared_ptr<std::vector<chain::header>>& block) NOEXCEPT
+{
+    chain::header_cptrs header_ptrs{};
+    header_ptrs.reserve(block->size());
+
+    for (const auto& header: *block)
+        header_ptrs.push_back(chain::header::cptr{ block, &header });
+
+    return header_ptrs;
+}
+
 // static
+// Hashes are set from the wire bytes of each header, retained inline in the
+// block, before the block is shared by the header pointers.
 typename headers::cptr headers::deserialize(uint32_t version,
     const std::span<const uint8_t>& data) NOEXCEPT
 {
-    system::istream source{ { data.begin(), data.end() } };
-    system::byte_reader reader{ source };
-    const auto message = to_shared(deserialize(version, reader));
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
+    const auto block = read_block(version, reader);
     if (!reader)
         return nullptr;
 
     constexpr auto size = chain::header::serialized_size();
     auto hash = std::next(data.data(), size_variable(data.front()));
 
-    for (const auto& header: message->header_ptrs)
+    for (auto& header: *block)
     {
-        header->set_hash(bitcoin_hash(size, hash));
+        header.set_hash(bitcoin_hash(size, hash));
         std::advance(hash, add1(size));
     }
 
+    const auto message = to_shared<headers>();
+    message->header_ptrs = to_pointers(block);
     return message;
 }
 
 // static
 headers headers::deserialize(uint32_t version, reader& source) NOEXCEPT
 {
-    if (version < version_minimum || version > version_maximum)
-        source.invalidate();
-
-    const auto size = source.read_size(max_get_headers);
-    chain::header_cptrs header_ptrs{};
-    header_ptrs.reserve(size);
-
-    for (size_t header = 0; header < size; ++header)
-    {
-        header_ptrs.push_back(to_shared<chain::header>(source));
-        if (source.read_byte() != trail)
-            source.invalidate();
-    }
-
-    return { header_ptrs };
+    return { to_pointers(read_block(version, source)) };
 }
 
 bool headers::serialize(uint32_t version,
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/messages/peer/detail/inventory_columns.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitcoin/network/define.hpp>
+#include <bitcoin/network/messages/peer/enums/magic_numbers.hpp>
+
+// Four types are compared per instruction with sse2 (x86_64 baseline).
+#if defined(__SSE2__) || defined(_M_X64)
+    #define HAVE_INVENTORY_LANES
+    #include <emmintrin.h>
+#endif
+
+namespace libbitcoin {
+namespace network {
+namespace messages {
+namespace peer {
+
+using namespace system;
+
+using type_column = std_vector<inventory_item::type_id>;
+
+template <size_t Size>
+using type_ids = std::array<inventory_item::type_id, Size>;
+
+// Type matching.
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+inline bool is_any(inventory_item::type_id type,
+    const type_ids<Size>& values) NOEXCEPT
+{
+    return std::find(values.begin(), values.end(), type) != values.end();
+}
+
+#if defined(HAVE_INVENTORY_LANES)
+constexpr size_t lanes = 4;
+
+// Types are loaded as four 32 bit integers per 128 bit register.
+static_assert(sizeof(inventory_item::type_id) == sizeof(uint32_t));
+
+// Bit mask of the four types (from row) that match any of the values.
+template <size_t Size>
+inline unsigned mask(const inventory_item::type_id* row,
+    const type_ids<Size>& values) NOEXCEPT
+{
+    const auto types = _mm_loadu_si128(pointer_cast<const __m128i>(row));
+    auto matches = _mm_setzero_si128();
+
+    for (const auto value: values)
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi32(types,
+            _mm_set1_epi32(static_cast<int>(value))));
+
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(matches)));
+}
+#endif
+
+// Count of types that match any of the values (up to limit).
+template <size_t Size>
+static size_t matches(const type_column& types, const type_ids<Size>& values,
+    size_t limit=max_size_t) NOEXCEPT
+{
+    size_t found{};
+    size_t row{};
+
+#if defined(HAVE_INVENTORY_LANES)
+    for (; row + lanes <= types.size() && found < limit; row += lanes)
+        found += static_cast<size_t>(std::popcount(mask(&types[row],
+            values)));
+#endif
+
+    for (; row < types.size() && found < limit; ++row)
+        if (is_any(types[row], values))
+            ++found;
+
+    return std::min(found, limit);
+}
+
+// Invoke visitor with each row that matches any of the values (in order).
+template <size_t Size, typename Visitor>
+static void visit(const type_column& types, const type_ids<Size>& values,
+    Visitor&& visitor) NOEXCEPT
+{
+    size_t row{};
+
+#if defined(HAVE_INVENTORY_LANES)
+    for (; row + lanes <= types.size(); row += lanes)
+        for (auto bits = mask(&types[row], values); !is_zero(bits);
+            bits &= sub1(bits))
+            visitor(row + static_cast<size_t>(std::countr_zero(bits)));
+#endif
+
+    for (; row < types.size(); ++row)
+        if (is_any(types[row], values))
+            visitor(row);
+}
+
+// inventory_columns
+// ----------------------------------------------------------------------------
+
+// static
+inventory_columns inventory_columns::factory(
+    const inventory_items& items) NOEXCEPT
+{
+    inventory_columns out{};
+    out.types.reserve(items.size());
+    out.hashes.reserve(items.size());
+
+    for (const auto& item: items)
+    {
+        out.types.push_back(item.type);
+        out.hashes.push_back(item.hash);
+    }
+
+    return out;
+}
+
+// static
+typename inventory_columns::cptr inventory_columns::deserialize(
+    uint32_t version, const std::span<const uint8_t>& data) NOEXCEPT
+{
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
+    const auto message = to_shared(deserialize(version, reader));
+    return reader ? message : nullptr;
+}
+
+// static
+// Version is not validated, as the encoding is shared by three messages.
+inventory_columns inventory_columns::deserialize(uint32_t,
+    reader& source) NOEXCEPT
+{
+    const auto size = source.read_size(max_inventory);
+    inventory_columns out{};
+    out.types.reserve(size);
+    out.hashes.reserve(size);
+
+    for (size_t row{}; row < size; ++row)
+    {
+        out.types.push_back(inventory_item::to_type(
+            source.read_4_bytes_little_endian()));
+        out.hashes.push_back(source.read_hash());
+    }
+
+    return out;
+}
+
+bool inventory_columns::serialize(uint32_t version,
+    const system::data_slab& data) const NOEXCEPT
+{
+    system::ostream sink{ data };
+    system::byte_writer writer{ sink };
+    serialize(version, writer);
+    return writer;
+}
+
+void inventory_columns::serialize(uint32_t version,
+    writer& sink) const NOEXCEPT
+{
+    BC_DEBUG_ONLY(const auto bytes = size(version);)
+    BC_DEBUG_ONLY(const auto start = sink.get_write_position();)
+
+    sink.write_variable(rows());
+
+    for (size_t row{}; row < rows(); ++row)
+    {
+        sink.write_4_bytes_little_endian(
+            inventory_item::to_number(types[row]));
+        sink.write_bytes(hashes[row]);
+    }
+
+    BC_ASSERT(sink && sink.get_write_position() - start == bytes);
+}
+
+size_t inventory_columns::size(uint32_t version) const NOEXCEPT
+{
+    return variable_size(rows()) +
+        (rows() * inventory_item::size(version));
+}
+
+size_t inventory_columns::rows() const NOEXCEPT
+{
+    BC_ASSERT(types.size() == hashes.size());
+    return types.size();
+}
+
+inventory_item inventory_columns::at(size_t row) const NOEXCEPT
+{
+    return { types.at(row), hashes.at(row) };
+}
+
+inventory_items inventory_columns::to_items() const NOEXCEPT
+{
+    inventory_items out{};
+    out.reserve(rows());
+
+    for (size_t row{}; row < rows(); ++row)
+        out.push_back({ types[row], hashes[row] });
+
+    return out;
+}
+
+typename inventory_columns::hash_span inventory_columns::view() const NOEXCEPT
+{
+    return hashes;
+}
+
+bool inventory_columns::all(type_id type) const NOEXCEPT
+{
+    return count(type) == rows();
+}
+
+system::hashes inventory_columns::to_hashes(type_id type) const NOEXCEPT
+{
+    system::hashes out{};
+    out.reserve(count(type));
+    visit(types, type_ids<1>{ type }, [&](size_t row) NOEXCEPT
+    {
+        out.push_back(hashes[row]);
+    });
+
+    return out;
+}
+
+size_t inventory_columns::count(type_id type) const NOEXCEPT
+{
+    return matches(types, type_ids<1>{ type });
+}
+
+bool inventory_columns::any(type_id type) const NOEXCEPT
+{
+    return !is_zero(matches(types, type_ids<1>{ type }, one));
+}
+
+} // namespace peer
+} // namespace messages
+} // namespace network
+} // namespace libbitcoin
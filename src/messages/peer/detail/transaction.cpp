@@ -37,8 +37,8 @@ const uint32_t transaction::version_maximum = level::maximum_protocol;
 typename transaction::cptr transaction::deserialize(uint32_t version,
     const std::span<const uint8_t>& data, bool witness) NOEXCEPT
 {
-    system::istream source{ { data.begin(), data.end() } };
-    system::byte_reader reader{ source };
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
     const auto message = to_shared(deserialize(version, reader, witness));
     if (!reader)
         return nullptr;
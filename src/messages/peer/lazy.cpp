@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/messages/peer/lazy.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <bitcoin/network/define.hpp>
+#include <bitcoin/network/interfaces/peer_registry.hpp>
+#include <bitcoin/network/messages/peer/peer.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace messages {
+namespace peer {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+bool lazy::relayable(size_t index) NOEXCEPT
+{
+    using registry = rpc::peer_registry;
+    return index == registry::index_of<transaction>()
+        || index == registry::index_of<inventory>()
+        || index == registry::index_of<address>();
+}
+
+// Structure (sizes only).
+// ----------------------------------------------------------------------------
+
+// Segregated witness flag (bip144).
+constexpr uint8_t witness_flag = 0x01;
+
+template <class Message>
+static bool is_version(uint32_t version) NOEXCEPT
+{
+    return version >= Message::version_minimum &&
+        version <= Message::version_maximum;
+}
+
+static void skip_script(reader& source) NOEXCEPT
+{
+    source.skip_bytes(source.read_size(chain::max_block_size));
+}
+
+static void skip_transaction(reader& source, bool witness) NOEXCEPT
+{
+    constexpr auto point_size = hash_size + sizeof(uint32_t);
+    source.skip_bytes(sizeof(uint32_t));
+
+    // A zero input count is the witness marker when witness is parsed.
+    auto inputs = source.read_size(chain::max_block_size);
+    const auto segregated = witness && is_zero(inputs);
+    if (segregated)
+    {
+        if (source.read_byte() != witness_flag)
+            source.invalidate();
+
+        inputs = source.read_size(chain::max_block_size);
+    }
+
+    for (size_t input{}; input < inputs && source; ++input)
+    {
+        source.skip_bytes(point_size);
+        skip_script(source);
+        source.skip_bytes(sizeof(uint32_t));
+    }
+
+    const auto outputs = source.read_size(chain::max_block_size);
+    for (size_t output{}; output < outputs && source; ++output)
+    {
+        source.skip_bytes(sizeof(uint64_t));
+        skip_script(source);
+    }
+
+    if (segregated)
+    {
+        for (size_t input{}; input < inputs && source; ++input)
+        {
+            const auto elements = source.read_size(chain::max_block_size);
+            for (size_t element{}; element < elements && source; ++element)
+                skip_script(source);
+        }
+    }
+
+    source.skip_bytes(sizeof(uint32_t));
+}
+
+bool lazy::structured(size_t index, const std::span<const uint8_t>& data,
+    uint32_t version, bool witness) NOEXCEPT
+{
+    using registry = rpc::peer_registry;
+    system::stream::in::fast source{ { data.begin(), data.end() } };
+    system::read::bytes::fast reader{ source };
+
+    if (index == registry::index_of<transaction>())
+    {
+        if (!is_version<transaction>(version))
+            return false;
+
+        skip_transaction(reader, witness);
+    }
+    else if (index == registry::index_of<inventory>())
+    {
+        if (!is_version<inventory>(version))
+            return false;
+
+        constexpr auto item_size = sizeof(uint32_t) + hash_size;
+        reader.skip_bytes(reader.read_size(max_inventory) * item_size);
+    }
+    else if (index == registry::index_of<address>())
+    {
+        if (!is_version<address>(version))
+            return false;
+
+        const auto item_size = address_item::size(version,
+            version >= level::address_timestamp);
+        reader.skip_bytes(reader.read_size(max_address) * item_size);
+    }
+    else
+    {
+        return false;
+    }
+
+    return reader && reader.is_exhausted();
+}
+
+lazy::lazy(const heading& head, size_t index, chunk_cptr&& payload,
+    uint32_t version, bool witness) NOEXCEPT
+  : head_{ head },
+    index_{ index },
+    payload_{ std::move(payload) },
+    version_{ version },
+    witness_{ witness }
+{
+}
+
+const heading& lazy::head() const NOEXCEPT
+{
+    return head_;
+}
+
+size_t lazy::index() const NOEXCEPT
+{
+    return index_;
+}
+
+const chunk_cptr& lazy::payload() const NOEXCEPT
+{
+    return payload_;
+}
+
+uint32_t lazy::version() const NOEXCEPT
+{
+    return version_;
+}
+
+bool lazy::witness() const NOEXCEPT
+{
+    return witness_;
+}
+
+// Writes are always witness (see transaction), so the read witness context
+// must match. Only address encoding varies by version (address timestamps).
+bool lazy::reusable(uint32_t version, bool witness) const NOEXCEPT
+{
+    using registry = rpc::peer_registry;
+    return witness == witness_ &&
+        (index_ != registry::index_of<address>() || version == version_);
+}
+
+// The checksum is computed (not copied), as it may not have been validated.
+chunk_ptr lazy::to_frame(uint32_t magic) const NOEXCEPT
+{
+    const auto size = ceilinged_add(heading::size(), payload_->size());
+    const auto data = emplace_shared<data_chunk>(size);
+    const auto start = std::next(data->begin(), heading::size());
+    std::copy(payload_->begin(), payload_->end(), start);
+
+    if (!heading::factory(magic, head_.command, *payload_).serialize(*data))
+        return {};
+
+    return data;
+}
+
+inventory_columns::cptr lazy::to_columns() const NOEXCEPT
+{
+    using registry = rpc::peer_registry;
+    if (index_ != registry::index_of<inventory>())
+        return {};
+
+    return inventory_columns::deserialize(version_, *payload_);
+}
+
+const rpc::any_t& lazy::message() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    if (!parsed_)
+    {
+        message_ = rpc::peer_registry::to_any(index_, *payload_, version_,
+            witness_);
+        parsed_ = true;
+    }
+
+    return message_;
+}
+
+BC_POP_WARNING()
+
+} // namespace peer
+} // namespace messages
+} // namespace network
+} // namespace libbitcoin
@@ -40,13 +40,30 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 using namespace system;
 using namespace std::placeholders;
 
+// Factory for the bip324 session keypair pool (or null).
+inline privacy::keypool::ptr make_keypool(const settings& settings) NOEXCEPT
+{
+    return settings.enable_privacy && !is_zero(settings.privacy_keypool) ?
+        emplace_shared<privacy::keypool>(settings.privacy_keypool) : nullptr;
+}
+
 net::net(const settings& settings, const logger& log,
     uint64_t required_services) NOEXCEPT
   : settings_(settings),
-    encryption_{ settings.identifier },
+    encryption_{ settings.identifier, make_keypool(settings) },
     threadpool_(std::max(settings.threads, 1_u32)),
     strand_(threadpool_.service().get_executor()),
     hosts_(settings, log, required_services),
+    resolutions_(emplace_shared<resolver_cache>(settings.resolve_cache())),
+    egress_(is_zero(settings.egress_limit) ? nullptr :
+        emplace_shared<egress>(settings.egress_limit)),
+    ingress_(is_zero(settings.ingress_limit) ? nullptr :
+        emplace_shared<ingress>(settings.ingress_limit)),
+    congestion_(is_zero(settings.queue_high_water) &&
+        is_zero(settings.queue_maximum) ? nullptr :
+        emplace_shared<congestion>(is_zero(settings.queue_high_water) ?
+            settings.queue_maximum : settings.queue_high_water,
+            settings.queue_maximum)),
     reporter(log)
 {
     ////LOG_LOG("Aplication log compiled..: ", news_defined);
@@ -73,6 +90,9 @@ net::~net() NOEXCEPT
 // server
 acceptor::ptr net::create_service(socket::parameters&& params) NOEXCEPT
 {
+    params.scheduler = egress_;
+    params.budget = ingress_;
+    params.congestion = congestion_;
     return emplace_shared<acceptor>(log, strand(), service(),
         service_suspended_, std::move(params));
 }
@@ -91,6 +111,11 @@ acceptor::ptr net::create_acceptor(const socket::context& context) NOEXCEPT
     {
         .connect_timeout = settings.connect_timeout(),
         .maximum_request = settings.inbound.maximum_request,
+        .read_ahead = settings.read_ahead,
+        .tuning = settings.inbound.socket_tuning(),
+        .scheduler = egress_,
+        .budget = ingress_,
+        .congestion = congestion_,
         .context = accept
     };
 
@@ -101,24 +126,31 @@ acceptor::ptr net::create_acceptor(const socket::context& context) NOEXCEPT
 // outbound (general)
 connector::ptr net::create_connector(const settings::socks5& socks,
     const steady_clock::duration& connect_timeout,
-    uint32_t maximum_request) NOEXCEPT
+    uint32_t maximum_request, const socket::tuning& tuning) NOEXCEPT
 {
     socket::parameters params
     {
         .connect_timeout = connect_timeout,
-        .maximum_request = maximum_request
+        .connect_stagger = network_settings().connect_stagger(),
+        .maximum_request = maximum_request,
+        .read_ahead = network_settings().read_ahead,
+        .tuning = tuning,
+        .scheduler = egress_,
+        .budget = ingress_,
+        .congestion = congestion_
     };
 
     if (network_settings().enable_privacy)
         params.context = std::cref(encryption_);
 
+    // Connectors share the resolution cache, as they share the net strand.
     if (socks.proxied())
         return emplace_shared<connector_socks>(log, strand(), service(),
-            connect_suspended_, std::move(params), socks);
+            connect_suspended_, std::move(params), socks, resolutions_);
 
     // Above can handle both proxy and non-proxy, but this is more efficient.
     return emplace_shared<connector>(log, strand(), service(),
-        connect_suspended_, std::move(params));
+        connect_suspended_, std::move(params), resolutions_);
 }
 
 // outbound (seed)
@@ -128,7 +160,8 @@ connector::ptr net::create_seed_connector() NOEXCEPT
 
     return create_connector(settings.outbound,
         settings.outbound.seeding_timeout(),
-        settings.outbound.maximum_request);
+        settings.outbound.maximum_request,
+        settings.outbound.socket_tuning());
 }
 
 // outbound (manual)
@@ -138,7 +171,8 @@ connector::ptr net::create_manual_connector() NOEXCEPT
 
     return create_connector(settings.manual,
         settings.connect_timeout(),
-        settings.manual.maximum_request);
+        settings.manual.maximum_request,
+        settings.manual.socket_tuning());
 }
 
 // outbound (batch)
@@ -148,10 +182,12 @@ connectors_ptr net::create_connectors(size_t count) NOEXCEPT
     const auto connects = to_shared<connectors>();
     connects->reserve(count);
 
+    const auto tuning = settings.outbound.socket_tuning();
+
     for (size_t connect{}; connect < count; ++connect)
         connects->push_back(create_connector(settings.outbound,
             settings.connect_timeout(),
-            settings.outbound.maximum_request));
+            settings.outbound.maximum_request, tuning));
 
     return connects;
 }
@@ -264,6 +300,12 @@ void net::close() NOEXCEPT
     {
         LOGF("Hosts file failed to serialize, " << error_code.message());
     }
+
+    const auto pool = buffer_statistics();
+    LOGN("Buffer pool reused (" << pool.reused << ") allocated ("
+        << pool.allocated << ") retained (" << pool.retained
+        << ") discarded (" << pool.discarded << ") holding (" << pool.buffers
+        << ") buffers of (" << pool.bytes << ") bytes.");
 }
 
 void net::do_close() NOEXCEPT
@@ -365,6 +407,20 @@ bool net::stranded() const NOEXCEPT
     return strand_.running_in_this_thread();
 }
 
+const ingress::ptr& net::read_budget() const NOEXCEPT
+{
+    return ingress_;
+}
+
+const congestion::ptr& net::write_backlog() const NOEXCEPT
+{
+    return congestion_;
+}
+
+buffer_pool::statistics net::buffer_statistics() const NOEXCEPT
+{
+    return buffer_pool::get().stats();
+}
 
 // Subscriptions.
 // ----------------------------------------------------------------------------
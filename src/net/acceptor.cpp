@@ -38,7 +38,9 @@ using namespace std::placeholders;
 // ----------------------------------------------------------------------------
 // Boost: "The io_context object that the acceptor will use to dispatch
 // handlers for any asynchronous operations performed on the acceptor."
-// Calls are stranded to protect the acceptor member.
+// Calls are stranded to protect the acceptor member. The asio acceptor is
+// bound to its own strand, so that accept completions (and the subsequent
+// socket setup) of each acceptor are not serialized on the network strand.
 
 acceptor::acceptor(const logger& log, asio::strand& strand,
     asio::context& service, std::atomic_bool& suspended,
@@ -47,7 +49,8 @@ acceptor::acceptor(const logger& log, asio::strand& strand,
     service_(service),
     suspended_(suspended),
     parameters_(std::move(parameters)),
-    acceptor_(strand_),
+    shard_(service.get_executor()),
+    acceptor_(shard_),
     reporter(log),
     tracker<acceptor>(log)
 {
@@ -86,11 +89,54 @@ code acceptor::start(const asio::endpoint& point) NOEXCEPT
     if (!ec)
         acceptor_.set_option(asio::reuse_address(true), ec);
 
+#if defined(HAVE_LINUX) && defined(SO_REUSEPORT)
+    // Required of each acceptor sharing the bind (see session::acceptors).
+    if (!ec && parameters_.tuning.reuse_port)
+        acceptor_.set_option(asio::reuse_port(true), ec);
+#endif
+
     if (!ec)
         acceptor_.bind(point, ec);
 
+    // Buffer sizes are inherited by accepted sockets, and are set before the
+    // handshake so that the advertised window scale is consistent with them.
+    // Not fatal, as the kernel may reject or clamp a size (system defaults).
+    const auto& tuning = parameters_.tuning;
+    const auto advise = [&](const auto& option, const char* name) NOEXCEPT
+    {
+        boost_code tuned{};
+        acceptor_.set_option(option, tuned);
+        if (tuned)
+        {
+            LOGX("Acceptor tune " << name << " error (" << tuned.value()
+                << ") " << tuned.category().name() << " : "
+                << tuned.message());
+        }
+    };
+
+    if (!ec && !is_zero(tuning.send_buffer))
+        advise(asio::send_buffer_size(limit<int>(tuning.send_buffer)),
+            "send_buffer");
+
+    if (!ec && !is_zero(tuning.receive_buffer))
+        advise(asio::receive_buffer_size(limit<int>(tuning.receive_buffer)),
+            "receive_buffer");
+
+#if defined(TCP_FASTOPEN)
+    // Not fatal, as kernel support is a system configuration.
+    if (!ec && tuning.fast_open && !is_zero(tuning.fast_open_queue))
+    {
+        boost_code ignore{};
+        acceptor_.set_option(asio::tcp_option<TCP_FASTOPEN>(
+            limit<int>(tuning.fast_open_queue)), ignore);
+    }
+#endif
+
+    const auto backlog = is_zero(tuning.backlog) ?
+        asio::socket::max_listen_connections : limit<int>(tuning.backlog);
+
     if (!ec)
-        acceptor_.listen(asio::socket::max_listen_connections, ec);
+        acceptor_.listen(backlog, ec);
 
     if (!ec)
     {
@@ -165,7 +211,7 @@ void acceptor::handle_accept(const code& ec, const socket::ptr& socket,
     const socket_handler& handler) NOEXCEPT
 {
     // Return from socket handshake (TLS) is socket-stranded.
-    // Return from socket accept (no TLS) is acceptor (network) stranded.
+    // Return from socket accept (no TLS) is acceptor (shard) stranded.
     if (!stranded())
     {
         boost::asio::post(strand_,
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/net/congestion.hpp>
+
+#include <algorithm>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+using namespace system;
+
+congestion::congestion(uint64_t high_water, uint64_t maximum) NOEXCEPT
+  : high_water_(std::max(high_water, 1_u64)),
+    maximum_(maximum)
+{
+}
+
+void congestion::add(size_t bytes) NOEXCEPT
+{
+    queued_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// Removal never exceeds prior addition, as channels remove only what they add.
+void congestion::remove(size_t bytes) NOEXCEPT
+{
+    queued_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool congestion::congested(size_t bytes) const NOEXCEPT
+{
+    return ceilinged_add<uint64_t>(queued(), bytes) >= high_water_;
+}
+
+bool congestion::overflowed(size_t bytes) const NOEXCEPT
+{
+    return !is_zero(maximum_) &&
+        ceilinged_add<uint64_t>(queued(), bytes) > maximum_;
+}
+
+uint64_t congestion::queued() const NOEXCEPT
+{
+    return queued_.load(std::memory_order_relaxed);
+}
+
+uint64_t congestion::high_water() const NOEXCEPT
+{
+    return high_water_;
+}
+
+uint64_t congestion::maximum() const NOEXCEPT
+{
+    return maximum_;
+}
+
+} // namespace network
+} // namespace libbitcoin
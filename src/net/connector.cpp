@@ -18,9 +18,11 @@
  */
 #include <bitcoin/network/net/connector.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <bitcoin/network/config/config.hpp>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/log/log.hpp>
@@ -48,11 +50,12 @@ constexpr auto encryption = messages::peer::service::node_encrypted_transport;
 
 connector::connector(const logger& log, asio::strand& strand,
     asio::context& service, std::atomic_bool& suspended,
-    parameters&& parameters) NOEXCEPT
+    parameters&& parameters, const resolver_cache::ptr& cache) NOEXCEPT
   : strand_(strand),
     service_(service),
     suspended_(suspended),
     parameters_(std::move(parameters)),
+    cache_(cache),
     resolver_(strand),
     timer_(emplace_shared<deadline>(log, strand, parameters.connect_timeout)),
     reporter(log),
@@ -140,20 +143,64 @@ void connector::start(const std::string& hostname, uint16_t port,
     if (!address.is_advertised(encryption))
         parameters.context = {};
 
+    // Fast open completes the connect without a handshake, which would void
+    // the timer and the staggered race, so it is limited to a numeric host.
+    asio::endpoint point{};
+    const auto numeric = resolver_cache::to_endpoint(point, hostname, port);
+    if (!numeric)
+        parameters.tuning.fast_open = false;
+
     // Create the outbound socket and shared finish context.
     const auto finish = emplace_shared<bool>(false);
     const auto socket = emplace_shared<network::socket>(log, service_,
         parameters, address, endpoint, proxied());
 
+    // Retain socket construction for staggered attempts of a resolved range.
+    attempts_ = emplace_shared<attempts>(attempts
+    {
+        .parameters = parameters,
+        .address = address,
+        .endpoint = endpoint
+    });
+
     // Posts handle_timer to strand.
     timer_->start(
         std::bind(&connector::handle_timer,
             shared_from_this(), _1, finish, socket));
 
-    // Posts handle_resolve to strand (async_resolve copies strings).
+    // Numeric host is connected directly, without resolver or thread hop.
+    if (numeric)
+    {
+        handle_resolve({}, asio::endpoints::create(point, hostname, {}),
+            finish, socket);
+        return;
+    }
+
+    // Cached resolution of a hostname is connected directly.
+    asio::endpoints range{};
+    if (cache_ && cache_->find(range, hostname, port))
+    {
+        handle_resolve({}, range, finish, socket);
+        return;
+    }
+
+    // Posts handle_lookup to strand (async_resolve copies strings).
     resolver_.async_resolve(hostname, std::to_string(port),
-        std::bind(&connector::handle_resolve,
-            shared_from_this(), _1, _2, finish, socket));
+        std::bind(&connector::handle_lookup,
+            shared_from_this(), _1, _2, hostname, port, finish, socket));
+}
+
+// private
+void connector::handle_lookup(const boost_code& ec,
+    const asio::endpoints& range, const std::string& hostname, uint16_t port,
+    const finish_ptr& finish, const socket::ptr& socket) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (!ec && cache_)
+        cache_->store(hostname, port, range);
+
+    handle_resolve(ec, range, finish, socket);
 }
 
 // private
@@ -187,6 +234,16 @@ void connector::handle_resolve(const boost_code& ec,
         return;
     }
 
+    // Multiple addresses are raced in staggered parallel (rfc8305).
+    if (!is_zero(parameters_.connect_stagger.count()) && range.size() > one)
+    {
+        attempts_->points = interleave(range);
+        attempts_->stagger = emplace_shared<deadline>(log, strand_,
+            parameters_.connect_stagger);
+        do_attempt(attempts_, finish, socket);
+        return;
+    }
+
     // Posts do_handle_connect to the socket's strand.
     // Establishes a socket connection by trying each endpoint in sequence.
     socket->connect(range,
@@ -194,6 +251,148 @@ void connector::handle_resolve(const boost_code& ec,
             shared_from_this(), _1, finish, socket));
 }
 
+// Staggered connect.
+// ----------------------------------------------------------------------------
+// Attempts start in order at the stagger interval, or upon failure of the
+// latest. The first success wins and stops the others. Only the final outcome
+// is passed to handle_connect, so the timer race is unchanged. The primary
+// socket makes the first attempt and carries any failure or timer stop.
+
+// protected
+std::vector<asio::endpoint> connector::interleave(
+    const asio::endpoints& range) NOEXCEPT
+{
+    // Alternate address families, starting with the first family resolved.
+    std::vector<asio::endpoint> first{}, other{};
+    const auto v6 = range.begin()->endpoint().address().is_v6();
+    for (const auto& entry: range)
+        (entry.endpoint().address().is_v6() == v6 ? first : other)
+            .push_back(entry.endpoint());
+
+    std::vector<asio::endpoint> points{};
+    points.reserve(first.size() + other.size());
+    for (size_t index{}; index < std::max(first.size(), other.size()); ++index)
+    {
+        if (index < first.size()) points.push_back(first.at(index));
+        if (index < other.size()) points.push_back(other.at(index));
+    }
+
+    return points;
+}
+
+// private
+void connector::do_attempt(const attempts::ptr& state,
+    const finish_ptr& finish, const socket::ptr& primary) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (state->done || state->expired ||
+        state->started == state->points.size())
+        return;
+
+    const auto index = state->started++;
+    const auto attempt = is_zero(index) ? primary :
+        emplace_shared<network::socket>(log, service_, state->parameters,
+            state->address, state->endpoint, proxied());
+
+    state->sockets.push_back(attempt);
+    attempt->connect(
+        asio::endpoints::create(state->points.at(index), {}, {}),
+        std::bind(&connector::do_handle_attempt,
+            shared_from_this(), _1, state, finish, primary, attempt));
+
+    // Restarts the stagger interval for the next attempt.
+    if (state->started < state->points.size())
+        state->stagger->start(
+            std::bind(&connector::handle_stagger,
+                shared_from_this(), _1, state, finish, primary));
+}
+
+// private
+void connector::handle_stagger(const code& ec, const attempts::ptr& state,
+    const finish_ptr& finish, const socket::ptr& primary) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Canceled by completion or restart.
+    if (ec)
+        return;
+
+    do_attempt(state, finish, primary);
+}
+
+// private
+void connector::do_handle_attempt(const code& ec, const attempts::ptr& state,
+    const finish_ptr& finish, const socket::ptr& primary,
+    const socket::ptr& attempt) NOEXCEPT
+{
+    BC_ASSERT(attempt->stranded());
+
+    boost::asio::post(strand_,
+        std::bind(&connector::handle_attempt,
+            shared_from_this(), ec, state, finish, primary, attempt));
+}
+
+// private
+void connector::handle_attempt(const code& ec, const attempts::ptr& state,
+    const finish_ptr& finish, const socket::ptr& primary,
+    const socket::ptr& attempt) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // A straggler of a decided race.
+    if (state->done)
+    {
+        attempt->stop();
+        return;
+    }
+
+    if (!ec)
+    {
+        state->done = true;
+        state->stagger->stop();
+        for (const auto& socket: state->sockets)
+            if (socket != attempt)
+                socket->stop();
+
+        handle_connect(ec, finish, attempt);
+        return;
+    }
+
+    // The primary is retained for the final outcome (stopped there).
+    ++state->failed;
+    if (attempt != primary)
+        attempt->stop();
+
+    // Failure starts the next attempt without waiting on the stagger.
+    if (!state->expired && state->started < state->points.size())
+    {
+        do_attempt(state, finish, primary);
+        return;
+    }
+
+    if (state->failed == state->started)
+    {
+        state->done = true;
+        state->stagger->stop();
+        handle_connect(ec, finish, primary);
+    }
+}
+
+// private
+void connector::stop_attempts() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (!attempts_ || !attempts_->stagger)
+        return;
+
+    attempts_->expired = true;
+    attempts_->stagger->stop();
+    for (const auto& socket: attempts_->sockets)
+        socket->stop();
+}
+
 // private
 void connector::do_handle_connect(const code& ec, const finish_ptr& finish,
     const socket::ptr& socket) NOEXCEPT
@@ -259,6 +458,7 @@ void connector::handle_timer(const code& ec, const finish_ptr& finish,
     {
         // Socket stop is thread safe, dispatching to its own strand.
         socket->stop();
+        stop_attempts();
         resolver_.cancel();
         racer_.finish(ec, socket);
         return;
@@ -268,6 +468,7 @@ void connector::handle_timer(const code& ec, const finish_ptr& finish,
     // Timer fires with error::success, change to error::operation_timeout.
     // Stopped socket returned with failure code for option of host recovery.
     socket->stop();
+    stop_attempts();
     resolver_.cancel();
     racer_.finish(error::operation_timeout, socket);
 }
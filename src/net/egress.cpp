@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/net/egress.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+egress::egress(uint32_t rate) NOEXCEPT
+  : rate_(std::max(rate, 1_u32))
+{
+}
+
+// Buckets are keyed on the channel, weighted by the setting of its service.
+steady_clock::duration egress::charge(uint64_t channel, uint32_t weight,
+    size_t bytes) NOEXCEPT
+{
+    using fractional = std::chrono::duration<double>;
+    const std::lock_guard lock(mutex_);
+    const auto now = steady_clock::now();
+    expire(now);
+
+    auto [it, created] = buckets_.try_emplace(channel);
+    auto& bucket = it->second;
+    bucket.active = now;
+
+    // An idle (or new) channel rejoins the sum of active weights.
+    weight = std::max(weight, 1_u32);
+    if (!bucket.counted)
+    {
+        bucket.counted = true;
+        weights_ += weight;
+        expiries_.push_back({ channel, now });
+    }
+    else
+    {
+        weights_ = weights_ - bucket.weight + weight;
+    }
+
+    bucket.weight = weight;
+
+    // Share of the global rate over the weights of the active channels.
+    const auto share = rate_ * (static_cast<double>(weight) / weights_);
+
+    // A new bucket starts full (one second of its share), as do read budgets.
+    if (created)
+    {
+        bucket.refill = now;
+        bucket.tokens = share;
+    }
+
+    // Refill at the current share, with one second of burst.
+    const auto elapsed = fractional(now - bucket.refill).count();
+    bucket.refill = now;
+    bucket.tokens = std::min(bucket.tokens + elapsed * share, share);
+    bucket.tokens -= static_cast<double>(bytes);
+
+    if (bucket.tokens >= 0.0)
+        return {};
+
+    // Period in which the share repays the debt.
+    return std::chrono::duration_cast<steady_clock::duration>(
+        fractional(-bucket.tokens / share));
+}
+
+void egress::release(uint64_t channel) NOEXCEPT
+{
+    const std::lock_guard lock(mutex_);
+    const auto it = buckets_.find(channel);
+    if (it == buckets_.end())
+        return;
+
+    if (it->second.counted)
+        weights_ -= it->second.weight;
+
+    buckets_.erase(it);
+}
+
+// private, protected by mutex.
+// Each counted channel has one expiry, in order of its (re)activation. An
+// expiry of a channel active since its entry is requeued at that activity,
+// and of a released channel is discarded. A channel may therefore remain in
+// the sum for up to a window beyond its own, which only defers its exit.
+void egress::expire(const steady_clock::time_point& now) NOEXCEPT
+{
+    while (!expiries_.empty() && now - expiries_.front().active > window)
+    {
+        const auto channel = expiries_.front().channel;
+        expiries_.pop_front();
+
+        const auto it = buckets_.find(channel);
+        if (it == buckets_.end() || !it->second.counted)
+            continue;
+
+        auto& bucket = it->second;
+        if (now - bucket.active > window)
+        {
+            bucket.counted = false;
+            weights_ -= bucket.weight;
+        }
+        else
+        {
+            expiries_.push_back({ channel, bucket.active });
+        }
+    }
+}
+
+uint32_t egress::rate() const NOEXCEPT
+{
+    return rate_;
+}
+
+BC_POP_WARNING()
+
+} // namespace network
+} // namespace libbitcoin
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/net/ingress.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+ingress::ingress(uint32_t rate) NOEXCEPT
+  : rate_(std::max(rate, 1_u32)),
+    tokens_(static_cast<double>(rate_)),
+    refill_(steady_clock::now())
+{
+}
+
+steady_clock::duration ingress::charge(size_t bytes) NOEXCEPT
+{
+    using fractional = std::chrono::duration<double>;
+    const auto now = steady_clock::now();
+    double debt{};
+    {
+        const std::lock_guard lock(mutex_);
+
+        // Refill at the rate, with one second of burst (starts full).
+        const auto burst = static_cast<double>(rate_);
+        const auto elapsed = fractional(now - refill_).count();
+        refill_ = now;
+        tokens_ = std::min(tokens_ + elapsed * burst, burst);
+        tokens_ -= static_cast<double>(bytes);
+        debt = -tokens_;
+    }
+
+    if (debt <= 0.0)
+        return {};
+
+    // Period in which the rate repays the debt.
+    const auto delay = std::chrono::duration_cast<steady_clock::duration>(
+        fractional(debt / rate_));
+
+    deferrals_.fetch_add(one, std::memory_order_relaxed);
+    deferred_.fetch_add(delay.count(), std::memory_order_relaxed);
+    return delay;
+}
+
+uint32_t ingress::rate() const NOEXCEPT
+{
+    return rate_;
+}
+
+uint64_t ingress::deferrals() const NOEXCEPT
+{
+    return deferrals_.load(std::memory_order_relaxed);
+}
+
+steady_clock::duration ingress::deferred() const NOEXCEPT
+{
+    return steady_clock::duration{ deferred_.load(std::memory_order_relaxed) };
+}
+
+BC_POP_WARNING()
+
+} // namespace network
+} // namespace libbitcoin
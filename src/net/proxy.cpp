@@ -18,6 +18,8 @@
  */
 #include <bitcoin/network/net/proxy.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <utility>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/log/log.hpp>
@@ -30,19 +32,28 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 // Factory for variable deadline timer pointer construction (or null).
 inline deadline::ptr make_throttle(const logger& log, asio::strand& strand,
-    uint32_t rate_limit) NOEXCEPT
+    uint32_t rate_limit, bool scheduled) NOEXCEPT
 {
-    return to_bool(rate_limit) ?
+    return to_bool(rate_limit) || scheduled ?
         system::emplace_shared<deadline>(log, strand) : nullptr;
 }
 
 // This is created in a started state and must be stopped, as the subscribers
 // assert if not stopped. Subscribers may hold protocols even if the service
 // is not started.
-proxy::proxy(const socket::ptr& socket, uint32_t rate_limit) NOEXCEPT
+proxy::proxy(const socket::ptr& socket, uint32_t rate_limit,
+    uint32_t read_limit, size_t high_water, size_t maximum) NOEXCEPT
   : rate_limit_(rate_limit),
+    read_limit_(read_limit),
+    high_water_(high_water),
+    maximum_(maximum),
     socket_(socket),
-    throttle_(make_throttle(socket->log, socket->strand(), rate_limit)),
+    throttle_(make_throttle(socket->log, socket->strand(), rate_limit,
+        to_bool(socket->scheduler()))),
+    reader_(make_throttle(socket->log, socket->strand(), read_limit,
+        to_bool(socket->budget()))),
+    refill_(steady_clock::now()),
+    tokens_(static_cast<double>(read_limit)),
     reporter(socket->log)
 {
 }
@@ -51,6 +62,10 @@ proxy::~proxy() NOEXCEPT
 {
     BC_ASSERT_MSG(stopped(), "proxy is not stopped");
     if (!stopped()) { LOGF("~proxy is not stopped."); }
+
+    // Unwritten bytes are no longer queued on the network.
+    if (const auto& backlog = socket_->backlog())
+        backlog->remove(queued());
 }
 
 // Stop (socket/proxy started upon create).
@@ -155,6 +170,9 @@ void proxy::stopping(const code& ec) NOEXCEPT
     // Release any deferred send (fires pending charge with canceled).
     if (throttle_) throttle_->stop();
 
+    // Release any deferred read (fires pending handler with canceled).
+    if (reader_) reader_->stop();
+
     // Release any http message parse in progress.
     parser_.reset();
 
@@ -216,6 +234,72 @@ bool proxy::paused() const NOEXCEPT
     return paused_;
 }
 
+// Read budget (read bytes are charged to the channel and global budgets).
+// ----------------------------------------------------------------------------
+// A read that overdraws a budget holds the read loop of the caller for the
+// repayment period, as a timed pause that does not affect the pause state.
+
+// protected
+bool proxy::deferred(size_t bytes, result_handler&& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    using namespace std::placeholders;
+
+    if (!reader_ || stopped())
+        return false;
+
+    // The longer of the channel and global deferrals applies.
+    auto delay = overdrawn(bytes);
+    if (const auto& budget = socket_->budget())
+        delay = std::max(delay, budget->charge(bytes));
+
+    if (is_zero(delay.count()))
+        return false;
+
+    deferrals_.fetch_add(one, std::memory_order_relaxed);
+    deferred_time_.fetch_add(delay.count(), std::memory_order_relaxed);
+
+    // Handler is posted to the strand, and fired by stop (canceled).
+    reader_->start(std::bind(&proxy::handle_deferred,
+        shared_from_this(), _1, std::move(handler)), delay);
+    return true;
+}
+
+// private
+steady_clock::duration proxy::overdrawn(size_t bytes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    using fractional = std::chrono::duration<double>;
+
+    if (is_zero(read_limit_))
+        return {};
+
+    // Refill at the channel rate, with one second of burst (starts full).
+    const auto now = steady_clock::now();
+    const auto burst = static_cast<double>(read_limit_);
+    const auto elapsed = fractional(now - refill_).count();
+    refill_ = now;
+    tokens_ = std::min(tokens_ + elapsed * burst, burst);
+    tokens_ -= static_cast<double>(bytes);
+
+    if (tokens_ >= 0.0)
+        return {};
+
+    // Period in which the channel rate repays the debt.
+    return std::chrono::duration_cast<steady_clock::duration>(
+        fractional(-tokens_ / burst));
+}
+
+// private
+void proxy::handle_deferred(const code& ec,
+    const result_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Stop fires the timer (canceled), which is passed to the handler.
+    handler(ec);
+}
+
 // Signal activity.
 // ----------------------------------------------------------------------------
 // override reading() to update timers.
@@ -285,6 +369,36 @@ uint64_t proxy::total() const NOEXCEPT
     return total_.load(std::memory_order_relaxed);
 }
 
+uint64_t proxy::deferrals() const NOEXCEPT
+{
+    return deferrals_.load(std::memory_order_relaxed);
+}
+
+steady_clock::duration proxy::deferred() const NOEXCEPT
+{
+    return steady_clock::duration
+    {
+        deferred_time_.load(std::memory_order_relaxed)
+    };
+}
+
+uint64_t proxy::queued() const NOEXCEPT
+{
+    return queued_.load(std::memory_order_relaxed);
+}
+
+uint64_t proxy::dropped() const NOEXCEPT
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool proxy::congested() const NOEXCEPT
+{
+    const auto& backlog = socket_->backlog();
+    return (!is_zero(high_water_) && queued() >= high_water_) ||
+        (backlog && backlog->congested());
+}
+
 const config::address& proxy::address() const NOEXCEPT
 {
     return socket_->address();
@@ -120,16 +120,25 @@ void proxy::read(data_chunk& buffer, frame& message,
     socket_->peer_read(buffer, message, std::move(handler));
 }
 
-void proxy::write(frame&& message, count_handler&& handler) NOEXCEPT
+void proxy::write(frame&& message, priority level, size_t size,
+    count_handler&& handler) NOEXCEPT
 {
     // Pointer ships moveable message through the send queue.
+    // The frame and handler are retained by the job for coalescing.
     const auto out = move_shared(std::move(message));
-    writer call = std::bind(&proxy::do_peer_write,
-        shared_from_this(), out, std::move(handler));
+    job item
+    {
+        .call = std::bind(&proxy::do_peer_write,
+            shared_from_this(), out, handler),
+        .frame = out,
+        .handler = std::move(handler),
+        .level = level,
+        .bytes = size
+    };
 
     boost::asio::dispatch(strand(),
-        std::bind(&proxy::do_write,
-            shared_from_this(), std::move(call)));
+        std::bind(&proxy::do_enqueue,
+            shared_from_this(), std::move(item)));
 }
 
 // private
@@ -18,8 +18,11 @@
  */
 #include <bitcoin/network/net/proxy.hpp>
 
+#include <algorithm>
 #include <bitcoin/network/define.hpp>
+#include <bitcoin/network/interfaces/peer_registry.hpp>
 #include <bitcoin/network/log/log.hpp>
+#include <bitcoin/network/messages/messages.hpp>
 
 // stackoverflow.com/questions/7754695/boost-asio-async-write-how-to-not-
 // interleaving-async-write-calls
@@ -32,13 +35,22 @@ BC_PUSH_WARNING(NO_VALUE_OR_CONST_REF_SHARED_PTR)
 BC_PUSH_WARNING(SMART_PTR_NOT_NEEDED)
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
+using namespace system;
+using namespace messages::peer;
 using namespace std::placeholders;
 
-// Send cycle (send continues until queue is empty).
+// Send cycle (send continues until queues are empty).
 // ----------------------------------------------------------------------------
 // private
+// The job at the front of the current class queue is in flight until popped,
+// so the loop is started exactly when a write is queued to empty queues.
 
 void proxy::do_write(const writer& call) NOEXCEPT
+{
+    do_enqueue({ .call = call });
+}
+
+void proxy::do_enqueue(const job& item) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
@@ -49,40 +61,227 @@ void proxy::do_write(const writer& call) NOEXCEPT
         return;
     }
 
-    const auto started = !queue_.empty();
-    queue_.push_back(call);
+    // A write beyond the limits is dropped or stops the channel.
+    if (!admit(item))
+        return;
+
+    const auto started = pending();
+    queues_.at(static_cast<size_t>(item.level)).push_back(item);
 
     // Start the asynchronous loop if it wasn't already started.
     if (!started)
         write();
 }
 
+bool proxy::pending() const NOEXCEPT
+{
+    return std::any_of(queues_.begin(), queues_.end(),
+        [](const queue& jobs) NOEXCEPT { return !jobs.empty(); });
+}
+
+// The highest class with a queued write is selected, unless a lower class
+// has been passed over starvation_limit times, in which case it goes once.
+proxy::queue& proxy::select() NOEXCEPT
+{
+    auto next = classes;
+    for (size_t index{}; index < classes; ++index)
+    {
+        if (queues_.at(index).empty())
+            continue;
+
+        if (next == classes)
+            next = index;
+        else if (++passed_.at(index) > starvation_limit)
+            next = index;
+    }
+
+    current_ = next;
+    passed_.at(current_) = zero;
+    return queues_.at(current_);
+}
+
 void proxy::write() NOEXCEPT
 {
     BC_ASSERT(stranded());
-    if (queue_.empty())
+    if (!pending())
         return;
 
-    // Invokes oldest writer on the queue, completion invokes handle_write.
-    queue_.front()();
+    // Consecutive peer frames are written together, completing in order.
+    auto& jobs = select();
+    if (gather(jobs))
+        return;
+
+    // Invokes oldest writer of the class, completion invokes handle_write.
+    jobs.front().call();
 }
 
 void proxy::handle_write(const code& ec, size_t bytes,
     const count_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
-    if (queue_.empty())
+    auto& jobs = queues_.at(current_);
+    if (jobs.empty())
         return;
 
     // Handler precedes pop so that a handler send does not start a second
     // write loop (a non-empty queue defers the start to the pop below).
     handler(ec, bytes);
-    queue_.pop_front();
+    release(jobs.front().bytes);
+    jobs.pop_front();
 
     // All handlers must be invoked unless stopped, so continue despite code.
     write();
 }
 
+// Backlog (queued peer bytes are accounted per channel and on the network).
+// ----------------------------------------------------------------------------
+// private
+// Only peer messages are sized, other writes are admitted unaccounted. Only
+// droppable (announcement) writes are dropped, as responses must be delivered
+// or the request fails silently, and control messages are required. So the
+// channel or network maximum is enforced by stopping the channel, and the
+// high-water marks (reached, as opposed to exceeded) by dropping.
+
+bool proxy::admit(const job& item) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (is_zero(item.bytes))
+        return true;
+
+    const auto total = ceilinged_add<uint64_t>(queued(), item.bytes);
+    if (!is_zero(maximum_) && total > maximum_)
+    {
+        LOGR("Write queue overflow [" << endpoint() << "] (" << total
+            << " bytes)");
+        stop(error::channel_overflow);
+        return false;
+    }
+
+    const auto& backlog = socket_->backlog();
+    if (backlog && backlog->overflowed(item.bytes))
+    {
+        LOGR("Network write queue overflow [" << endpoint() << "] ("
+            << backlog->queued() << " bytes)");
+        stop(error::channel_overflow);
+        return false;
+    }
+
+    if (is_droppable(item.level) &&
+        ((!is_zero(high_water_) && total >= high_water_) ||
+        (backlog && backlog->congested(item.bytes))))
+    {
+        dropped_.fetch_add(one, std::memory_order_relaxed);
+        item.handler(error::write_dropped, zero);
+        return false;
+    }
+
+    queued_ = total;
+    if (backlog) backlog->add(item.bytes);
+    return true;
+}
+
+void proxy::release(size_t bytes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (is_zero(bytes))
+        return;
+
+    queued_ = floored_subtract<uint64_t>(queued(), bytes);
+    if (const auto& backlog = socket_->backlog())
+        backlog->remove(bytes);
+}
+
+// Coalesce (consecutive peer frames become one write).
+// ----------------------------------------------------------------------------
+// private
+// Frames are sized here so that the byte budget can be applied. A single
+// frame takes the writer path, as does any v1 frame that fails to serialize
+// (so that it reports its own failure). Frames are serialized (v1) for one
+// scatter/gather write, or encrypted (v2) as consecutive packets of one write.
+
+bool proxy::gather(const queue& jobs) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (jobs.size() < two || !jobs.at(zero).frame || !jobs.at(one).frame)
+        return false;
+
+    frame_ptrs frames{};
+    std::vector<size_t> sizes{};
+    size_t bytes{};
+    for (const auto& item: jobs)
+    {
+        if (!item.frame || frames.size() == gather_frames)
+            break;
+
+        const auto size = framed(*item.frame);
+        if (is_zero(size) || (!frames.empty() &&
+            ceilinged_add(bytes, size) > gather_bytes))
+            break;
+
+        bytes += size;
+        frames.push_back(item.frame);
+        sizes.push_back(size);
+    }
+
+    if (frames.size() < two)
+        return false;
+
+    // The gather write is metered as one send of the total bytes.
+    socket_->peer_write(frames,
+        metered(std::bind(&proxy::handle_gather,
+            shared_from_this(), _1, _2, std::move(sizes))));
+    return true;
+}
+
+void proxy::handle_gather(const code& ec, size_t bytes,
+    const std::vector<size_t>& sizes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Each handler is credited its own frame bytes, in order, from the total
+    // written. Handlers precede pops (see handle_write).
+    auto& jobs = queues_.at(current_);
+    for (auto size = sizes.begin(); size != sizes.end() && !jobs.empty();
+        ++size)
+    {
+        const auto item = jobs.front();
+        const auto sent = std::min(*size, bytes);
+        bytes -= sent;
+
+        item.handler(ec, sent);
+        release(item.bytes);
+        jobs.pop_front();
+    }
+
+    write();
+}
+
+// Bytes of the frame as written, zero if it cannot be serialized. A v1 frame
+// is serialized (and retained for the write), a v2 packet is only sized.
+size_t proxy::framed(frame& out) const NOEXCEPT
+{
+    using registry = rpc::peer_registry;
+
+    if (encrypted())
+    {
+        if (out.index >= registry::size)
+            return zero;
+
+        return privacy::stream::packet_size(
+            registry::identifiers().at(out.index),
+            registry::to_payload_size(out.index, out.message, out.version));
+    }
+
+    if (!out.data)
+        out.data = registry::to_frame(out.index, out.message, out.magic,
+            out.version);
+
+    return out.data ? out.data->size() : zero;
+}
+
 // Throttle (sent bytes are allocated time at the configured rate).
 // ----------------------------------------------------------------------------
 // private
@@ -114,8 +313,8 @@ steady_clock::duration proxy::unconsumed(size_t bytes,
 {
     BC_ASSERT(stranded());
 
-    // Stop is never deferred, and a null throttle implies no rate limit.
-    if (!throttle_ || stopped())
+    // Stop is never deferred, and a zero rate implies no rate limit.
+    if (!throttle_ || is_zero(rate_limit_) || stopped())
         return {};
 
     const auto allocated = to_allocation(bytes, rate_limit_);
@@ -132,7 +331,10 @@ void proxy::handle_metered(const code& ec, size_t bytes,
     total_ = system::ceilinged_add(total_.load(), bytes);
 
     // A send that consumed its full allocation is not deferred.
-    const auto delay = unconsumed(bytes, start);
+    auto delay = unconsumed(bytes, start);
+    if (throttle_ && !stopped())
+        delay = std::max(delay, scheduled(bytes));
+
     if (is_zero(delay.count()))
     {
         handler(ec, bytes);
@@ -144,6 +346,12 @@ void proxy::handle_metered(const code& ec, size_t bytes,
         shared_from_this(), _1, ec, bytes, handler), delay);
 }
 
+// protected/virtual
+steady_clock::duration proxy::scheduled(size_t) NOEXCEPT
+{
+    return {};
+}
+
 void proxy::handle_charge(const code&, const code& ec, size_t bytes,
     const count_handler& handler) NOEXCEPT
 {
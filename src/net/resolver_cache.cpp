@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/net/resolver_cache.hpp>
+
+#include <iterator>
+#include <string>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+using namespace system;
+
+resolver_cache::resolver_cache(const duration& lifetime,
+    size_t capacity) NOEXCEPT
+  : lifetime_(lifetime), capacity_(capacity)
+{
+}
+
+bool resolver_cache::to_endpoint(asio::endpoint& out,
+    const std::string& host, uint16_t port) NOEXCEPT
+{
+    const auto bracketed = host.size() > two &&
+        host.front() == '[' && host.back() == ']';
+
+    boost_code ec{};
+    const auto ip = boost::asio::ip::make_address(bracketed ?
+        host.substr(one, host.size() - two) : host, ec);
+
+    if (ec)
+        return false;
+
+    out = { ip, port };
+    return true;
+}
+
+bool resolver_cache::find(asio::endpoints& out, const std::string& host,
+    uint16_t port) NOEXCEPT
+{
+    const auto it = map_.find({ host, port });
+    if (it == map_.end())
+        return false;
+
+    if (it->second.expiry <= steady_clock::now())
+    {
+        map_.erase(it);
+        return false;
+    }
+
+    out = it->second.range;
+    return true;
+}
+
+void resolver_cache::store(const std::string& host, uint16_t port,
+    const asio::endpoints& range) NOEXCEPT
+{
+    if (is_zero(lifetime_.count()) || range.empty() || is_zero(capacity_))
+        return;
+
+    const auto now = steady_clock::now();
+    if (map_.size() >= capacity_)
+        prune(now);
+
+    // Expired entries are pruned, but live entries are arbitrarily evicted.
+    if (map_.size() >= capacity_)
+        map_.erase(map_.begin());
+
+    map_.insert_or_assign({ host, port }, entry{ range, now + lifetime_ });
+}
+
+size_t resolver_cache::size() const NOEXCEPT
+{
+    return map_.size();
+}
+
+// private
+void resolver_cache::prune(const steady_clock::time_point& now) NOEXCEPT
+{
+    for (auto it = map_.begin(); it != map_.end();)
+        it = it->second.expiry <= now ? map_.erase(it) : std::next(it);
+}
+
+BC_POP_WARNING()
+
+} // namespace network
+} // namespace libbitcoin
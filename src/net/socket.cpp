@@ -68,6 +68,11 @@ socket::socket(const logger& log, asio::context& service,
   : inbound_(inbound),
     proxied_(proxied),
     maximum_(params.maximum_request),
+    read_ahead_(params.read_ahead),
+    tuning_(params.tuning),
+    scheduler_(params.scheduler),
+    budget_(params.budget),
+    backlog_(params.congestion),
     strand_(service.get_executor()),
     service_(service),
     context_(params.context),
@@ -75,6 +80,7 @@ socket::socket(const logger& log, asio::context& service,
     endpoint_(endpoint),
     timer_(emplace_shared<deadline>(log, strand_, params.connect_timeout)),
     socket_(std::in_place_type<asio::socket>, strand_),
+    ahead_(params.read_ahead),
     reporter(log),
     tracker<socket>(log)
 {
@@ -99,6 +105,21 @@ asio::strand& socket::strand() NOEXCEPT
     return strand_;
 }
 
+const egress::ptr& socket::scheduler() const NOEXCEPT
+{
+    return scheduler_;
+}
+
+const ingress::ptr& socket::budget() const NOEXCEPT
+{
+    return budget_;
+}
+
+const congestion::ptr& socket::backlog() const NOEXCEPT
+{
+    return backlog_;
+}
+
 bool socket::stranded() const NOEXCEPT
 {
     return strand_.running_in_this_thread();
@@ -18,6 +18,7 @@
  */
 #include <bitcoin/network/net/socket.hpp>
 
+#include <iterator>
 #include <utility>
 #include <variant>
 #include <bitcoin/network/config/config.hpp>
@@ -27,6 +28,7 @@
 namespace libbitcoin {
 namespace network {
 
+using namespace system;
 using namespace std::placeholders;
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
@@ -38,9 +40,9 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 // acceptor may be guarded from its own strand while preserving hiding of
 // socket internals. This makes concurrent calls unsafe, however only the
 // acceptor (a socket factory) requires access to the socket at this time.
-// network::acceptor both invokes this call in the network strand and
-// initializes the asio::acceptor with the network strand. So the call to
-// acceptor.async_accept invokes its handler on that strand as well.
+// network::acceptor invokes this call in the network strand and initializes
+// the asio::acceptor with its own (shard) strand. So the call to
+// acceptor.async_accept invokes its handler on the shard strand.
 
 void socket::accept(asio::acceptor& acceptor,
     result_handler&& handler) NOEXCEPT
@@ -49,7 +51,7 @@ void socket::accept(asio::acceptor& acceptor,
         "accept on open socket");
     try
     {
-        // Dispatches on the acceptor's strand (which should be network).
+        // Dispatches on the acceptor's strand (its shard, not network).
         // Cannot move handler due to catch block invocation.
         acceptor.async_accept(get_base(),
             std::bind(&socket::handle_accept,
@@ -93,6 +95,10 @@ void socket::handle_accept(boost_code ec,
         return;
     }
 
+    // Tuning failures are logged, the connection proceeds with defaults.
+    // Buffer sizes are inherited from the acceptor (set before listen).
+    tune();
+
     // Not in socket strand.
     do_handshake(handler);
 }
@@ -116,12 +122,63 @@ void socket::do_connect(const asio::endpoints& range,
     BC_ASSERT_MSG(!get_base().is_open(),
         "connect on open socket");
 
+    if (range.empty())
+    {
+        handle_connect(boost::asio::error::not_found, {}, handler);
+        return;
+    }
+
+    do_connect_next(range, zero, handler);
+}
+
+// private
+// Establishes a socket connection by trying each endpoint in sequence (as
+// does asio::async_connect). The socket is opened here for each endpoint, so
+// that the options which must precede connect are set upon it. Buffer sizes
+// determine the window scale advertised in the SYN, and fast open carries the
+// first write (version or bip324 key) in the SYN. As a fast open connect
+// completes without a handshake, the connector requests it only for a numeric
+// host (never raced), see connector::start.
+void socket::do_connect_next(const asio::endpoints& range, size_t index,
+    const result_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // A stop between attempts closes the socket, which is not reopened.
+    if (stopped_.load())
+    {
+        handler(error::operation_canceled);
+        return;
+    }
+
     try
     {
-        // Establishes a socket connection by trying each endpoint in sequence.
-        boost::asio::async_connect(get_base(), range,
-            std::bind(&socket::handle_connect,
-                shared_from_this(), _1, _2, handler));
+        const auto peer = std::next(range.begin(), index)->endpoint();
+        auto& base = get_base();
+        boost_code ec{};
+        base.close(ec);
+        base.open(peer.protocol(), ec);
+        if (ec)
+        {
+            handle_connect_next(ec, range, index, handler);
+            return;
+        }
+
+        // Tuning failures are logged, the connection proceeds with defaults.
+        tune_buffers();
+
+#if defined(TCP_FASTOPEN_CONNECT)
+        // Failure to set the option is not fatal, connects normally.
+        if (tuning_.fast_open)
+        {
+            boost_code ignore{};
+            base.set_option(asio::tcp_option<TCP_FASTOPEN_CONNECT>(1), ignore);
+        }
+#endif
+
+        base.async_connect(peer,
+            std::bind(&socket::handle_connect_next,
+                shared_from_this(), _1, range, index, handler));
     }
     catch (const std::exception& e)
     {
@@ -130,6 +187,24 @@ void socket::do_connect(const asio::endpoints& range,
     }
 }
 
+// private
+void socket::handle_connect_next(const boost_code& ec,
+    const asio::endpoints& range, size_t index,
+    const result_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Upon failure the next endpoint is tried, unless canceled (stop).
+    const auto next = add1(index);
+    if (ec && !error::asio_is_canceled(ec) && next < range.size())
+    {
+        do_connect_next(range, next, handler);
+        return;
+    }
+
+    handle_connect(ec, std::next(range.begin(), index)->endpoint(), handler);
+}
+
 void socket::handle_connect(const boost_code& ec, const asio::endpoint& peer,
     const result_handler& handler) NOEXCEPT
 {
@@ -153,6 +228,11 @@ void socket::handle_connect(const boost_code& ec, const asio::endpoint& peer,
         return;
     }
 
+    // Options apply to the tcp connection, which may be to the socks proxy.
+    // Tuning failures are logged, the connection proceeds with defaults.
+    // Buffer sizes are set before connect (see do_connect_next).
+    tune();
+
     // Defer handshake to the connector when connection is proxied.
     if (proxied_)
     {
@@ -196,7 +276,7 @@ void socket::do_handshake(const result_handler& handler) NOEXCEPT
 
         // P2PS (bip324) context is applied to the socket.
         socket_.emplace<privacy::stream>(std::move(socket),
-            std::get<cref<privacy::context>>(context_).get());
+            std::get<cref<privacy::context>>(context_).get(), read_ahead_);
 
         // Posts handler to socket strand.
         get_p2ps().async_handshake(
@@ -263,7 +343,8 @@ void socket::handle_detection(const boost_code& ec,
     auto socket = std::move(get_base());
 
     // P2PS (bip324) context is applied to the socket.
-    socket_.emplace<privacy::stream>(std::move(socket), context);
+    socket_.emplace<privacy::stream>(std::move(socket), context,
+        read_ahead_);
 
     // Posts handler to socket strand.
     get_p2ps().async_handshake(std::move(key),
@@ -322,6 +403,77 @@ void socket::handle_handshake(const boost_code& ec,
     handler(code);
 }
 
+// Tuning.
+// ----------------------------------------------------------------------------
+
+// private
+// Each option is independent and advisory, so a failure does not preclude
+// the others and does not fail the connection.
+template <typename Option>
+void socket::advise(const Option& option) NOEXCEPT
+{
+    boost_code ec{};
+    get_base().set_option(option, ec);
+    if (ec) logx("tune", ec);
+}
+
+// private
+// Stranded, called after open and before connect, as the buffer sizes
+// determine the window scale advertised in the SYN (see do_connect_next).
+void socket::tune_buffers() NOEXCEPT
+{
+    if (!is_zero(tuning_.send_buffer))
+        advise(asio::send_buffer_size(limit<int>(tuning_.send_buffer)));
+
+    if (!is_zero(tuning_.receive_buffer))
+        advise(asio::receive_buffer_size(limit<int>(tuning_.receive_buffer)));
+}
+
+// private
+// Not stranded, called from accept and connect completion (see accept).
+void socket::tune() NOEXCEPT
+{
+    if (tuning_.no_delay)
+        advise(asio::no_delay(true));
+
+#if defined(TCP_NOTSENT_LOWAT)
+    if (!is_zero(tuning_.unsent_low_water))
+        advise(asio::tcp_option<TCP_NOTSENT_LOWAT>(
+            limit<int>(tuning_.unsent_low_water)));
+#endif
+
+    if (!is_zero(tuning_.keepalive_idle.count()))
+    {
+        advise(asio::keep_alive(true));
+
+#if defined(TCP_KEEPIDLE)
+        advise(asio::tcp_option<TCP_KEEPIDLE>(
+            limit<int>(tuning_.keepalive_idle.count())));
+#elif defined(TCP_KEEPALIVE)
+        advise(asio::tcp_option<TCP_KEEPALIVE>(
+            limit<int>(tuning_.keepalive_idle.count())));
+#endif
+    }
+
+#if defined(TCP_KEEPINTVL)
+    if (!is_zero(tuning_.keepalive_interval.count()))
+        advise(asio::tcp_option<TCP_KEEPINTVL>(
+            limit<int>(tuning_.keepalive_interval.count())));
+#endif
+
+#if defined(TCP_KEEPCNT)
+    if (!is_zero(tuning_.keepalive_probes))
+        advise(asio::tcp_option<TCP_KEEPCNT>(
+            limit<int>(tuning_.keepalive_probes)));
+#endif
+
+#if defined(TCP_USER_TIMEOUT)
+    if (!is_zero(tuning_.user_timeout.count()))
+        advise(asio::tcp_option<TCP_USER_TIMEOUT>(
+            limit<int>(tuning_.user_timeout.count())));
+#endif
+}
+
 BC_POP_WARNING()
 
 } // namespace network
@@ -18,11 +18,14 @@
  */
 #include <bitcoin/network/net/socket.hpp>
 
+#include <algorithm>
 #include <utility>
 #include <variant>
+#include <vector>
 #include <bitcoin/network/define.hpp>
 #include <bitcoin/network/interfaces/peer_registry.hpp>
 #include <bitcoin/network/log/log.hpp>
+#include <bitcoin/network/memory.hpp>
 
 namespace libbitcoin {
 namespace network {
@@ -38,7 +41,10 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 // The message is framed, so reads are exact (see socket_body.cpp for the
 // taxonomy), obtaining the heading and then the payload it indicates. Writes
-// pass the messages::peer::body type to the body_ methods.
+// serialize the frame and write it directly to the stream. When read_ahead is
+// configured (v1 only), frames that fit the buffer are instead drawn from
+// large reads of whatever the peer has sent, so that a sequence of small
+// messages costs one socket read rather than two reads per message.
 
 void socket::peer_read(data_chunk& buffer, frame& message,
     count_handler&& handler) NOEXCEPT
@@ -66,18 +72,36 @@ void socket::do_peer_read(size_t total, const peer_state::ptr& in,
         return;
     }
 
+    // Fill the read-ahead buffer when it can hold the need but does not yet.
     const auto need = in->reader.need();
-    if (in->headed) in->payload.resize(need);
+    const auto buffered = ceilinged_add(detection_.size(), ahead_.size());
+    if (need <= read_ahead_ && buffered < need)
+    {
+        do_peer_fill(total, in, handler);
+        return;
+    }
+
+    // The payload buffer is drawn from the shared pool when insufficient.
+    if (in->headed) buffer_pool::get().fit(in->payload, need);
     const auto data = in->headed ? in->payload.data() : in->head.data();
 
-    // Drain the retained detection prefix (v1 peer) into the read.
-    const auto residue = std::min(detection_.size(), need);
-    if (!is_zero(residue))
+    // Drain the retained detection prefix (v1 peer) and read-ahead bytes.
+    const auto residue = drain(data, need);
+    if (residue == need)
     {
-        const auto region = detection_.data();
-        std::copy_n(pointer_cast<const uint8_t>(region.data()), residue,
-            data);
-        detection_.consume(residue);
+        // A frame that starts from buffered bytes is posted, so that a reader
+        // which reads again from its handler does not recurse on the stack.
+        if (!in->headed)
+        {
+            boost::asio::post(strand_,
+                std::bind(&socket::handle_peer_read,
+                    shared_from_this(), error::success, zero, residue, total,
+                    in, handler));
+            return;
+        }
+
+        handle_peer_read(error::success, zero, residue, total, in, handler);
+        return;
     }
 
     async_read({ std::next(data, residue), need - residue },
@@ -85,6 +109,44 @@ void socket::do_peer_read(size_t total, const peer_state::ptr& in,
             shared_from_this(), _1, _2, residue, total, in, handler));
 }
 
+// private
+void socket::do_peer_fill(size_t total, const peer_state::ptr& in,
+    const count_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    try
+    {
+        // Read whatever is available, up to the read-ahead capacity.
+        const auto space = floored_subtract(ahead_.max_size(), ahead_.size());
+        async_read_some(ahead_.prepare(space),
+            std::bind(&socket::handle_peer_fill,
+                shared_from_this(), _1, _2, total, in, handler));
+    }
+    catch (const std::exception& e)
+    {
+        LOGF("Exception @ do_peer_fill: " << e.what());
+        handler(error::operation_failed, total);
+    }
+}
+
+// private
+void socket::handle_peer_fill(const code& ec, size_t size, size_t total,
+    const peer_state::ptr& in, const count_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (ec)
+    {
+        handler(ec, total);
+        return;
+    }
+
+    // Bytes are counted as they are drained into the frame (see drain).
+    ahead_.commit(size);
+    do_peer_read(total, in, handler);
+}
+
 // private
 void socket::handle_peer_read(const code& ec, size_t size, size_t residue,
     size_t total, const peer_state::ptr& in,
@@ -140,6 +202,19 @@ void socket::handle_peer_read_encrypted(const boost_code& ec,
     handler(error::http_to_error_code(code), in->payload.size());
 }
 
+// Serialize the message payload into the given (packet) region.
+inline privacy::stream::payload_writer to_writer(const frame_ptr& out) NOEXCEPT
+{
+    return [out](const std::span<uint8_t>& data) NOEXCEPT
+    {
+        using registry = rpc::peer_registry;
+        const data_slab body{ data.data(), std::next(data.data(),
+            data.size()) };
+        return registry::to_payload(out->index, out->message, out->version,
+            body);
+    };
+}
+
 void socket::peer_write(frame&& message,
     count_handler&& handler) NOEXCEPT
 {
@@ -158,26 +233,159 @@ void socket::do_peer_write(const frame_ptr& out,
     if (encrypted())
     {
         using registry = rpc::peer_registry;
-        const auto payload = registry::to_payload(out->index, out->message,
-            out->version);
-
-        if (!payload || out->index >= registry::size)
+        if (out->index >= registry::size)
         {
             handler(error::bad_stream, zero);
             return;
         }
 
+        // The payload is serialized directly into the (pooled) packet buffer
+        // and encrypted there, without an intermediate payload allocation.
+        const auto size = registry::to_payload_size(out->index, out->message,
+            out->version);
+
         get_p2ps().async_write_message(
             registry::identifiers().at(out->index),
-            std::string{ registry::commands().at(out->index) }, payload,
+            std::string{ registry::commands().at(out->index) }, size,
+            to_writer(out),
             std::bind(&socket::handle_async,
                 shared_from_this(), _1, _2, handler, "async_write_message"));
         return;
     }
 
-    http::response response{};
-    response.body() = std::move(*out);
-    body_write(std::move(response), count_handler{ handler });
+    // The v1 frame is serialized (heading in place) and written directly,
+    // without http message, body writer, or write state construction. A frame
+    // already serialized (by the proxy, for framing or gather) is not redone.
+    if (!out->data)
+        out->data = rpc::peer_registry::to_frame(out->index, out->message,
+            out->magic, out->version);
+
+    if (!out->data)
+    {
+        handler(error::bad_stream, zero);
+        return;
+    }
+
+    do_peer_gather({ out }, handler);
+}
+
+void socket::peer_write(const frame_ptrs& messages,
+    count_handler&& handler) NOEXCEPT
+{
+    boost::asio::dispatch(strand_,
+        std::bind(&socket::do_peer_gather,
+            shared_from_this(), messages, std::move(handler)));
+}
+
+// private
+void socket::do_peer_gather(const frame_ptrs& out,
+    const count_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (encrypted())
+    {
+        do_peer_batch(out, handler);
+        return;
+    }
+
+    // Frames are serialized by the caller (see do_peer_write, proxy::gather).
+    std::vector<asio::const_buffer> buffers{};
+    buffers.reserve(out.size());
+    for (const auto& message: out)
+    {
+        if (!message->data)
+        {
+            handler(error::bad_stream, zero);
+            return;
+        }
+
+        buffers.emplace_back(message->data->data(), message->data->size());
+    }
+
+    try
+    {
+        // The buffer sequence is written with scatter/gather (writev).
+        VARIANT_DISPATCH_FUNCTION(boost::asio::async_write, get_tcp(),
+            buffers, std::bind(&socket::handle_async, shared_from_this(),
+                _1, _2, count_handler{ std::bind(&socket::handle_peer_gather,
+                    shared_from_this(), _1, _2, out, handler) },
+                "async_write"));
+    }
+    catch (const std::exception& e)
+    {
+        LOGF("Exception @ do_peer_gather: " << e.what());
+        handler(error::operation_failed, zero);
+    }
+}
+
+// private
+void socket::do_peer_batch(const frame_ptrs& out,
+    const count_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    using registry = rpc::peer_registry;
+
+    // Messages become consecutive packets of one encrypted write.
+    privacy::stream::outgoings messages{};
+    messages.reserve(out.size());
+    for (const auto& message: out)
+    {
+        if (message->index >= registry::size)
+        {
+            handler(error::bad_stream, zero);
+            return;
+        }
+
+        messages.push_back(
+        {
+            .identifier = registry::identifiers().at(message->index),
+            .command = std::string{ registry::commands().at(message->index) },
+            .size = registry::to_payload_size(message->index,
+                message->message, message->version),
+            .writer = to_writer(message)
+        });
+    }
+
+    get_p2ps().async_write_messages(std::move(messages),
+        std::bind(&socket::handle_async,
+            shared_from_this(), _1, _2, handler, "async_write_messages"));
+}
+
+// private
+void socket::handle_peer_gather(const code& ec, size_t size,
+    const frame_ptrs&, const count_handler& handler) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // The frames are retained by the closure until the write completes.
+    handler(ec, size);
+}
+
+// Utility.
+// ----------------------------------------------------------------------------
+// private
+
+// Copy up to size retained bytes into data, detection prefix first.
+size_t socket::drain(uint8_t* data, size_t size) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    size_t drained{};
+
+    for (auto buffer: { &detection_, &ahead_ })
+    {
+        const auto count = std::min(buffer->size(), size - drained);
+        if (is_zero(count))
+            continue;
+
+        const auto region = buffer->data();
+        std::copy_n(pointer_cast<const uint8_t>(region.data()), count,
+            std::next(data, drained));
+        buffer->consume(count);
+        drained += count;
+    }
+
+    return drained;
 }
 
 BC_POP_WARNING()
@@ -18,7 +18,6 @@
  */
 #include <bitcoin/network/privacy/cipher.hpp>
 
-#include <random>
 #include <bitcoin/network/define.hpp>
 
 namespace libbitcoin {
@@ -33,35 +32,17 @@ BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
 // key derivation salt prefix.
 constexpr char salt_label[] = "bitcoin_v2_shared_secret";
 
-// This is to be used only for ephemeral network session keys.
-// Gather 256 bits of operating system entropy, conditioned by sha256.
-static hash_digest entropy() NOEXCEPT
+cipher::cipher() NOEXCEPT
+  : key_{}, secret_{}
 {
-    using word = std::random_device::result_type;
-    constexpr auto words = hash_size / sizeof(word);
-
-    std::random_device device{};
-    data_array<words * sizeof(word)> seed{};
-    auto it = seed.begin();
-
-    for (size_t count{}; count < words; ++count)
-    {
-        const auto value = to_little_endian(device());
-        it = std::copy(value.begin(), value.end(), it);
-    }
-
-    return sha256_hash(seed);
+    keypool::generate(secret_, key_);
 }
 
-cipher::cipher() NOEXCEPT
+cipher::cipher(const keypool::ptr& pool) NOEXCEPT
   : key_{}, secret_{}
 {
-    // A secret outside the group order is astronomically improbable.
-    do
-    {
-        secret_ = entropy();
-    }
-    while (!ellswift::create(key_, secret_, entropy()));
+    if (!pool || !pool->take(secret_, key_))
+        keypool::generate(secret_, key_);
 }
 
 cipher::cipher(const ec_secret& secret, const key& public_key) NOEXCEPT
@@ -150,6 +131,15 @@ void cipher::encrypt(std::span<const uint8_t> contents,
     send_packet_->encrypt(header, contents, aad, out.subspan(length_size));
 }
 
+// Contents alias the output exactly (same offset), as with decrypt.
+void cipher::encrypt(std::span<uint8_t> packet, bool ignore) NOEXCEPT
+{
+    BC_ASSERT(packet.size() >= expansion);
+    const auto size = packet.size() - expansion;
+    encrypt(packet.subspan(length_size + header_size, size), {}, ignore,
+        packet);
+}
+
 size_t cipher::decrypt_length(std::span<const uint8_t> in) NOEXCEPT
 {
     BC_ASSERT(in.size() == length_size);
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/network/privacy/keypool.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <bitcoin/network/async/async.hpp>
+#include <bitcoin/network/define.hpp>
+
+namespace libbitcoin {
+namespace network {
+namespace privacy {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// This is to be used only for ephemeral network session keys.
+// Gather 256 bits of operating system entropy, conditioned by sha256.
+static hash_digest entropy() NOEXCEPT
+{
+    using word = std::random_device::result_type;
+    constexpr auto words = hash_size / sizeof(word);
+
+    std::random_device device{};
+    data_array<words * sizeof(word)> seed{};
+    auto it = seed.begin();
+
+    for (size_t count{}; count < words; ++count)
+    {
+        const auto value = to_little_endian(device());
+        it = std::copy(value.begin(), value.end(), it);
+    }
+
+    return sha256_hash(seed);
+}
+
+// static
+void keypool::generate(ec_secret& secret, key& public_key) NOEXCEPT
+{
+    // A secret outside the group order is astronomically improbable.
+    do
+    {
+        secret = entropy();
+    }
+    while (!ellswift::create(public_key, secret, entropy()));
+}
+
+keypool::keypool(size_t capacity) NOEXCEPT
+  : capacity_(std::max(capacity, one)),
+    pool_(one, processing_priority::lowest)
+{
+    schedule();
+}
+
+keypool::~keypool() NOEXCEPT
+{
+    // Abandon any refill in progress, then join the thread.
+    stopped_.store(true);
+    pool_.stop();
+    pool_.join();
+
+    const std::lock_guard lock(mutex_);
+    for (auto& pair: keys_)
+        pair.secret = {};
+}
+
+bool keypool::take(ec_secret& secret, key& public_key) NOEXCEPT
+{
+    auto taken = false;
+    size_t remaining{};
+    {
+        const std::lock_guard lock(mutex_);
+        if (!keys_.empty())
+        {
+            auto& front = keys_.front();
+            secret = front.secret;
+            public_key = front.public_key;
+            front.secret = {};
+            keys_.pop_front();
+            remaining = keys_.size();
+            taken = true;
+        }
+    }
+
+    // Refill at half capacity (including when found empty).
+    if (remaining <= to_half(capacity_))
+        schedule();
+
+    return taken;
+}
+
+size_t keypool::size() const NOEXCEPT
+{
+    const std::lock_guard lock(mutex_);
+    return keys_.size();
+}
+
+size_t keypool::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+// private
+void keypool::schedule() NOEXCEPT
+{
+    // Only one refill is pending at a time.
+    if (!stopped_.load() && !refilling_.exchange(true))
+        boost::asio::post(pool_.service(), [this]() NOEXCEPT { refill(); });
+}
+
+// private
+// Keypairs are generated outside of the lock, so take is never blocked by EC.
+void keypool::refill() NOEXCEPT
+{
+    while (!stopped_.load() && size() < capacity_)
+    {
+        keypair pair{};
+        generate(pair.secret, pair.public_key);
+
+        const std::lock_guard lock(mutex_);
+        keys_.push_back(pair);
+        pair.secret = {};
+    }
+
+    refilling_.store(false);
+}
+
+BC_POP_WARNING()
+
+} // namespace privacy
+} // namespace network
+} // namespace libbitcoin
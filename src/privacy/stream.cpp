@@ -22,6 +22,7 @@
 #include <utility>
 #include <bitcoin/network/async/async.hpp>
 #include <bitcoin/network/define.hpp>
+#include <bitcoin/network/memory.hpp>
 #include <bitcoin/network/messages/messages.hpp>
 
 namespace libbitcoin {
@@ -54,8 +55,12 @@ bool stream::detected_v1(const std::span<const uint8_t>& prefix,
 // Constructor.
 // ----------------------------------------------------------------------------
 
-stream::stream(asio::socket&& socket, const context& context) NOEXCEPT
-  : socket_(std::move(socket)), identifier_(context.identifier)
+stream::stream(asio::socket&& socket, const context& context,
+    size_t read_ahead) NOEXCEPT
+  : cipher_(context.keys),
+    socket_(std::move(socket)),
+    identifier_(context.identifier),
+    read_ahead_(read_ahead)
 {
 }
 
@@ -202,7 +207,9 @@ void stream::scan_terminator(const handshake_handler& handler) NOEXCEPT
     {
         // Bytes beyond the terminator are packet stream residue.
         const auto end = std::next(position, terminator.size());
-        residue_.assign(end, garbage_.end());
+        ahead_.assign(end, garbage_.end());
+        ahead_start_ = zero;
+        ahead_end_ = ahead_.size();
         garbage_.erase(position, garbage_.end());
         read_versioning(true, handler);
         return;
@@ -309,14 +316,12 @@ void stream::handle_version_packet(const boost_code& ec, bool first,
 // Read pump.
 // ----------------------------------------------------------------------------
 
-// Read exactly out size bytes into out, drawing from replay residue first.
+// Read exactly out size bytes into out, drawing from read-ahead first.
 void stream::read_exactly(const std::span<uint8_t>& out,
     pump_handler&& handler) NOEXCEPT
 {
     const auto size = out.size();
-    const auto residue = std::min(size, residue_.size());
-    std::copy_n(residue_.begin(), residue, out.begin());
-    residue_.erase(residue_.begin(), std::next(residue_.begin(), residue));
+    const auto residue = drain(out);
 
     if (residue == size)
     {
@@ -341,19 +346,91 @@ void stream::handle_read(const boost_code& ec, size_t,
     handler(ec);
 }
 
+// Read whatever is available, up to the read-ahead capacity, following any
+// buffered bytes (moved to the front of the buffer).
+void stream::fill(pump_handler&& handler) NOEXCEPT
+{
+    const auto count = buffered();
+    const auto begin = std::next(ahead_.begin(), ahead_start_);
+    std::copy(begin, std::next(begin, count), ahead_.begin());
+    ahead_start_ = zero;
+    ahead_end_ = count;
+
+    if (ahead_.size() < read_ahead_)
+        ahead_.resize(read_ahead_);
+
+    const auto start = std::next(ahead_.data(), count);
+    const boost::asio::mutable_buffer in{ start, ahead_.size() - count };
+
+    socket_.async_read_some(in,
+        std::bind(&stream::handle_fill,
+            this, _1, _2, std::move(handler)));
+}
+
+void stream::handle_fill(const boost_code& ec, size_t size,
+    const pump_handler& handler) NOEXCEPT
+{
+    if (!ec)
+        ahead_end_ += size;
+
+    handler(ec);
+}
+
+size_t stream::buffered() const NOEXCEPT
+{
+    return ahead_end_ - ahead_start_;
+}
+
+size_t stream::drain(const std::span<uint8_t>& out) NOEXCEPT
+{
+    const auto count = std::min(out.size(), buffered());
+    std::copy_n(std::next(ahead_.begin(), ahead_start_), count, out.begin());
+    consume(count);
+    return count;
+}
+
+void stream::consume(size_t size) NOEXCEPT
+{
+    ahead_start_ += size;
+    if (ahead_start_ == ahead_end_)
+        ahead_start_ = ahead_end_ = zero;
+}
+
 // Read the encrypted length prefix and then the packet into the caller
 // buffer, decrypting it in place (skipping decoys). The payload is a span
 // over the buffer following the packet header and message type prefix.
+// With read-ahead, packets that fit the read-ahead are surfaced in order from
+// large socket reads, each decrypted from the read-ahead into the buffer, so
+// that a batch of small packets costs one socket read (not two per packet).
 void stream::async_read_message(data_chunk& buffer, size_t maximum,
     message_handler&& handler) NOEXCEPT
 {
-    packet_.resize(cipher::length_size);
+    constexpr auto need = cipher::length_size;
+    if (need <= read_ahead_ && buffered() < need)
+    {
+        fill(std::bind(&stream::handle_length_ahead,
+            this, _1, std::ref(buffer), maximum, std::move(handler)));
+        return;
+    }
 
+    packet_.resize(need);
     read_exactly(packet_,
         std::bind(&stream::handle_message_length,
             this, _1, std::ref(buffer), maximum, std::move(handler)));
 }
 
+void stream::handle_length_ahead(const boost_code& ec, data_chunk& buffer,
+    size_t maximum, const message_handler& handler) NOEXCEPT
+{
+    if (ec)
+    {
+        handler(ec, {}, {}, {});
+        return;
+    }
+
+    async_read_message(buffer, maximum, move_copy(handler));
+}
+
 void stream::handle_message_length(const boost_code& ec, data_chunk& buffer,
     size_t maximum, const message_handler& handler) NOEXCEPT
 {
@@ -373,13 +450,59 @@ void stream::handle_message_length(const boost_code& ec, data_chunk& buffer,
         return;
     }
 
-    buffer.resize(cipher::header_size + length + cipher::tag_size);
+    read_packet(buffer, length, maximum, handler);
+}
+
+// Called only from a completion (length read is posted when buffered).
+void stream::read_packet(data_chunk& buffer, size_t length, size_t maximum,
+    const message_handler& handler) NOEXCEPT
+{
+    const auto need = cipher::header_size + length + cipher::tag_size;
+    if (need <= read_ahead_ && buffered() < need)
+    {
+        fill(std::bind(&stream::handle_packet_ahead,
+            this, _1, std::ref(buffer), length, maximum, handler));
+        return;
+    }
+
+    // Decrypt from the read-ahead directly into the buffer (no copy).
+    if (buffered() >= need)
+    {
+        bool ignore{};
+        const auto start = std::next(ahead_.data(), ahead_start_);
+        const std::span<const uint8_t> packet{ start, need };
+        buffer.resize(cipher::header_size + length);
+        const auto valid = cipher_.decrypt(buffer, {}, ignore, packet);
+        consume(need);
+
+        if (!valid)
+        {
+            handler(protocol_error, {}, {}, {});
+            return;
+        }
+
+        handle_plain(ignore, buffer, buffer, maximum, handler);
+        return;
+    }
 
+    buffer.resize(need);
     read_exactly(buffer,
         std::bind(&stream::handle_message_read,
             this, _1, std::ref(buffer), length, maximum, handler));
 }
 
+void stream::handle_packet_ahead(const boost_code& ec, data_chunk& buffer,
+    size_t length, size_t maximum, const message_handler& handler) NOEXCEPT
+{
+    if (ec)
+    {
+        handler(ec, {}, {}, {});
+        return;
+    }
+
+    read_packet(buffer, length, maximum, handler);
+}
+
 void stream::handle_message_read(const boost_code& ec, data_chunk& buffer,
     size_t length, size_t maximum, const message_handler& handler) NOEXCEPT
 {
@@ -399,6 +522,12 @@ void stream::handle_message_read(const boost_code& ec, data_chunk& buffer,
         return;
     }
 
+    handle_plain(ignore, plain, buffer, maximum, handler);
+}
+
+void stream::handle_plain(bool ignore, const std::span<const uint8_t>& plain,
+    data_chunk& buffer, size_t maximum, const message_handler& handler) NOEXCEPT
+{
     // Decoy packets are discarded, contents are ignored.
     if (ignore)
     {
@@ -459,44 +588,141 @@ void stream::async_write_message(uint8_t identifier,
     const std::string& command, const chunk_cptr& payload,
     io_handler&& handler) NOEXCEPT
 {
-    using namespace messages::peer;
-    const auto prefix = is_zero(identifier) ? add1(heading::command_size) : one;
+    const auto size = payload ? payload->size() : zero;
+    async_write_message(identifier, command, size,
+        [payload](const std::span<uint8_t>& out) NOEXCEPT
+        {
+            if (!payload)
+                return false;
+
+            std::copy(payload->begin(), payload->end(), out.begin());
+            return true;
+        }, std::move(handler));
+}
+
+// The packet is assembled in one buffer: length, header, prefix, payload, tag.
+// The payload is serialized at its final offset and encrypted in place, so the
+// message is neither copied nor separately allocated. Writes are sequential,
+// so the buffer is reused until the write completes.
+void stream::async_write_message(uint8_t identifier,
+    const std::string& command, size_t size, payload_writer&& writer,
+    io_handler&& handler) NOEXCEPT
+{
+    if (!writable(identifier, command, size))
+    {
+        boost::asio::post(get_executor(),
+            std::bind(&stream::handle_message_sent,
+                this, protocol_error, size_t{}, std::move(handler)));
+        return;
+    }
 
-    if (!payload || command.size() > heading::command_size ||
-        payload->size() > cipher::maximum_content - prefix)
+    buffer_pool::get().fit(sending_, packet_size(identifier, size));
+    if (!pack(sending_, identifier, command, writer))
     {
         boost::asio::post(get_executor(),
             std::bind(&stream::handle_message_sent,
-                this, protocol_error, size_t{}, chunk_ptr{}, std::move(handler)));
+                this, protocol_error, size_t{}, std::move(handler)));
         return;
     }
 
-    data_chunk contents{};
-    contents.reserve(prefix + payload->size());
-    contents.push_back(identifier);
+    cipher_.encrypt(sending_, false);
+    const boost::asio::const_buffer out{ sending_.data(), sending_.size() };
 
-    if (is_zero(identifier))
+    boost::asio::async_write(socket_, out,
+        std::bind(&stream::handle_message_sent,
+            this, _1, _2, std::move(handler)));
+}
+
+// Packets are laid out consecutively in the one buffer. Encryption advances
+// the packet cipher (and its rekey counter) in write order.
+void stream::async_write_messages(outgoings&& messages,
+    io_handler&& handler) NOEXCEPT
+{
+    size_t total{};
+    auto valid = !messages.empty();
+    for (const auto& message: messages)
+    {
+        valid = valid && writable(message.identifier, message.command,
+            message.size);
+        total = ceilinged_add(total, packet_size(message.identifier,
+            message.size));
+    }
+
+    if (valid)
+    {
+        buffer_pool::get().fit(sending_, total);
+        std::span<uint8_t> packets{ sending_ };
+        for (const auto& message: messages)
+        {
+            const auto size = packet_size(message.identifier, message.size);
+            valid = valid && pack(packets.first(size), message.identifier,
+                message.command, message.writer);
+            packets = packets.subspan(size);
+        }
+    }
+
+    if (!valid)
     {
-        contents.resize(prefix, 0x00);
-        std::copy_n(command.begin(), command.size(),
-            std::next(contents.begin()));
+        boost::asio::post(get_executor(),
+            std::bind(&stream::handle_message_sent,
+                this, protocol_error, size_t{}, std::move(handler)));
+        return;
     }
 
-    contents.insert(contents.end(), payload->begin(), payload->end());
-    const auto bytes = contents.size() + cipher::expansion;
-    const auto packet = emplace_shared<data_chunk>(bytes);
-    cipher_.encrypt(contents, {}, false, *packet);
-    const boost::asio::const_buffer out{ packet->data(), packet->size() };
+    std::span<uint8_t> packets{ sending_ };
+    for (const auto& message: messages)
+    {
+        const auto size = packet_size(message.identifier, message.size);
+        cipher_.encrypt(packets.first(size), false);
+        packets = packets.subspan(size);
+    }
 
+    const boost::asio::const_buffer out{ sending_.data(), sending_.size() };
     boost::asio::async_write(socket_, out,
         std::bind(&stream::handle_message_sent,
-            this, _1, _2, packet, std::move(handler)));
+            this, _1, _2, std::move(handler)));
+}
+
+// static
+bool stream::writable(uint8_t identifier, const std::string& command,
+    size_t size) NOEXCEPT
+{
+    using namespace messages::peer;
+    const auto prefix = is_zero(identifier) ? add1(heading::command_size) : one;
+    return command.size() <= heading::command_size &&
+        size <= cipher::maximum_content - prefix;
+}
+
+// Write the message prefix and payload (unencrypted) into the packet contents.
+// static
+bool stream::pack(const std::span<uint8_t>& packet, uint8_t identifier,
+    const std::string& command, const payload_writer& writer) NOEXCEPT
+{
+    using namespace messages::peer;
+    constexpr auto offset = cipher::length_size + cipher::header_size;
+    const auto prefix = is_zero(identifier) ? add1(heading::command_size) : one;
+    const auto contents = packet.subspan(offset,
+        packet.size() - cipher::expansion);
+
+    contents.front() = identifier;
+    if (is_zero(identifier))
+    {
+        const auto start = std::next(contents.begin());
+        std::fill_n(start, heading::command_size, 0x00);
+        std::copy_n(command.begin(), command.size(), start);
+    }
+
+    return writer && writer(contents.subspan(prefix));
 }
 
-// The packet is bound to preserve its buffer for the write.
+// A buffer larger than the smallest pool class is returned to the pool, so
+// that a large (block) write does not pin its buffer to the session.
 void stream::handle_message_sent(const boost_code& ec, size_t size,
-    const chunk_ptr&, const io_handler& handler) NOEXCEPT
+    const io_handler& handler) NOEXCEPT
 {
+    if (sending_.capacity() > power2(buffer_pool::minimum_class))
+        buffer_pool::get().release(sending_);
+
     handler(ec, size);
 }
 
@@ -223,7 +223,9 @@ void protocol_seed_209::handle_send_address(const code& ec) NOEXCEPT
 {
     BC_ASSERT_MSG(stranded(), "protocol_seed_209");
 
-    if (stopped(ec))
+    // A dropped (congested) address announcement does not stop the channel,
+    // and the peer may request addresses again, so it does not fail seeding.
+    if (stopped(ec == error::write_dropped ? error::success : ec))
         return;
 
     // Multiple get_address messages are allowed, but do not delay stop.
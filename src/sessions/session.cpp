@@ -18,6 +18,7 @@
  */
 #include <bitcoin/network/sessions/session.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <bitcoin/network/channels/channels.hpp>
@@ -394,6 +395,23 @@ asio::strand& session::strand() NOEXCEPT
     return network_.strand();
 }
 
+// protected
+size_t session::acceptors(
+    const network::settings::tcp_server& options) const NOEXCEPT
+{
+    const auto threads = std::max(network_settings().threads, 1_u32);
+    const size_t count = is_zero(options.acceptors) ? threads :
+        options.acceptors;
+
+    // Each listener has its own kernel queue, outstanding accept and strand,
+    // so accept completion (and socket setup) proceeds on threads in parallel.
+#if defined(HAVE_LINUX) && defined(SO_REUSEPORT)
+    return count;
+#else
+    return std::min(count, one);
+#endif
+}
+
 const network::settings& session::network_settings() const NOEXCEPT
 {
     return network_.network_settings();
@@ -87,24 +87,36 @@ code session_inbound::do_accept(const config::authorities& binds) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    const auto count = acceptors(network_settings().inbound);
+
     for (const auto& bind: binds)
     {
-        const auto acceptor = create_acceptor();
-
-        // Require that all acceptors at least start.
-        if (const auto ec = acceptor->start(bind))
-            return ec;
-
-        LOGN("Bound to peer endpoint [" << acceptor->local() << "].");
+        // Shards bind the first endpoint, as its port may be ephemeral.
+        auto point = bind;
 
-        // Subscribe acceptor to stop desubscriber.
-        subscribe_stop([=](const code&) NOEXCEPT
+        for (size_t shard{}; shard < count; ++shard)
         {
-            acceptor->stop();
-            return false;
-        });
-
-        start_accept(error::success, acceptor);
+            const auto acceptor = create_acceptor();
+
+            // Require that all acceptors at least start.
+            if (const auto ec = acceptor->start(point))
+                return ec;
+
+            if (is_zero(shard))
+            {
+                point = acceptor->local();
+                LOGN("Bound to peer endpoint [" << point << "].");
+            }
+
+            // Subscribe acceptor to stop desubscriber.
+            subscribe_stop([=](const code&) NOEXCEPT
+            {
+                acceptor->stop();
+                return false;
+            });
+
+            start_accept(error::success, acceptor);
+        }
     }
 
     return error::success;
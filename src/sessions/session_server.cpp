@@ -111,31 +111,44 @@ code session_server::do_accept(const config::authorities& binds,
     // Currently only ssl context is secure.
     const auto secure = std::holds_alternative<ref<asio::ssl::context>>(context);
 
+    const auto count = acceptors(options_);
+
     for (const auto& bind: binds)
     {
-        // Each acceptor owns its parameters.
-        const auto acceptor = create_service(
-        {
-            .connect_timeout = network_settings().connect_timeout(),
-            .maximum_request = options_.maximum_request,
-            .context = context
-        });
-
-        // Require that all acceptors at least start.
-        if (const auto ec = acceptor->start(bind))
-            return ec;
-
-        LOGN("Bound to " << (secure ? "private " : "clear ")
-            << name_ << " endpoint [" << acceptor->local() << "].");
+        // Shards bind the first endpoint, as its port may be ephemeral.
+        auto point = bind;
 
-        // Subscribe acceptor to stop desubscriber.
-        subscribe_stop([=](const code&) NOEXCEPT
+        for (size_t shard{}; shard < count; ++shard)
         {
-            acceptor->stop();
-            return false;
-        });
-
-        start_accept(error::success, acceptor, secure);
+            // Each acceptor owns its parameters.
+            const auto acceptor = create_service(
+            {
+                .connect_timeout = network_settings().connect_timeout(),
+                .maximum_request = options_.maximum_request,
+                .tuning = options_.socket_tuning(),
+                .context = context
+            });
+
+            // Require that all acceptors at least start.
+            if (const auto ec = acceptor->start(point))
+                return ec;
+
+            if (is_zero(shard))
+            {
+                point = acceptor->local();
+                LOGN("Bound to " << (secure ? "private " : "clear ")
+                    << name_ << " endpoint [" << point << "].");
+            }
+
+            // Subscribe acceptor to stop desubscriber.
+            subscribe_stop([=](const code&) NOEXCEPT
+            {
+                acceptor->stop();
+                return false;
+            });
+
+            start_accept(error::success, acceptor, secure);
+        }
     }
 
     return error::success;
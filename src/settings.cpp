@@ -70,6 +70,25 @@ steady_clock::duration settings::tcp_server::expiration() const NOEXCEPT
     return minutes{ expiration_minutes };
 }
 
+network::tuning settings::tcp_server::socket_tuning() const NOEXCEPT
+{
+    return
+    {
+        .no_delay = no_delay,
+        .send_buffer = send_buffer,
+        .receive_buffer = receive_buffer,
+        .unsent_low_water = unsent_low_water,
+        .keepalive_idle = tuning::seconds{ keepalive_idle_seconds },
+        .keepalive_interval = tuning::seconds{ keepalive_interval_seconds },
+        .keepalive_probes = keepalive_probes,
+        .user_timeout = tuning::milliseconds{ user_timeout_milliseconds },
+        .backlog = listen_backlog,
+        .reuse_port = !is_one(acceptors),
+        .fast_open = fast_open,
+        .fast_open_queue = fast_open_queue
+    };
+}
+
 // tls_server
 // ----------------------------------------------------------------------------
 
@@ -286,6 +305,16 @@ steady_clock::duration settings::connect_timeout() const NOEXCEPT
     return milliseconds{ system::pseudo_random::next(from, to) };
 }
 
+steady_clock::duration settings::connect_stagger() const NOEXCEPT
+{
+    return milliseconds(connect_stagger_milliseconds);
+}
+
+steady_clock::duration settings::resolve_cache() const NOEXCEPT
+{
+    return seconds(resolve_cache_seconds);
+}
+
 steady_clock::duration settings::channel_handshake() const NOEXCEPT
 {
     return seconds(handshake_timeout_seconds);
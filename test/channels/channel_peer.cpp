@@ -25,6 +25,7 @@ class mock_channel_peer
 {
 public:
     using channel_peer::channel_peer;
+    using channel_peer::notify;
 
     // Call must be stranded.
     void subscribe_stop1(result_handler handler) NOEXCEPT
@@ -193,6 +194,143 @@ BOOST_AUTO_TEST_CASE(channel_peer__stop__all_subscribed__expected)
     BOOST_REQUIRE(result);
 }
 
+BOOST_AUTO_TEST_CASE(channel_peer__notify__retained__relay_and_message_subscribers)
+{
+    using namespace messages::peer;
+    const logger log{};
+    threadpool pool(2);
+    const settings set(bc::system::chain::selection::mainnet);
+    network::socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto channel_ptr = std::make_shared<mock_channel_peer>(log, socket_ptr, 42, set, options);
+
+    inventory expected{};
+    expected.items.push_back({ inventory_item::type_id::block, bc::system::null_hash });
+    const auto data = serialize(expected, level::maximum_protocol);
+    BOOST_REQUIRE(data);
+
+    frame in{};
+    in.head = heading::factory(set.identifier, inventory::command, *data);
+    const auto retained = to_shared<lazy>(in.head,
+        rpc::peer_registry::index_of<inventory>(), chunk_cptr{ data },
+        level::maximum_protocol, true);
+    in.payload = rpc::any_t{ lazy::cptr{ retained } };
+
+    lazy::cptr relayed{};
+    inventory::cptr dispatched{};
+    std::promise<code> notified;
+    boost::asio::post(channel_ptr->strand(), [&]() NOEXCEPT
+    {
+        channel_ptr->subscribe_relay([&](const code& ec, const lazy::cptr& message) NOEXCEPT
+        {
+            if (!ec) relayed = message;
+            return true;
+        });
+
+        channel_ptr->subscribe<inventory>([&](const code& ec, const inventory::cptr& message) NOEXCEPT
+        {
+            if (!ec) dispatched = message;
+            return true;
+        });
+
+        notified.set_value(channel_ptr->notify(in));
+    });
+
+    BOOST_REQUIRE_EQUAL(notified.get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(relayed, retained);
+    BOOST_REQUIRE(dispatched);
+    BOOST_REQUIRE(dispatched->items == expected.items);
+
+    // Message subscribers share the parse of the retained message.
+    BOOST_REQUIRE_EQUAL(dispatched, retained->get<inventory>());
+
+    // Stop is asynchronous, threadpool destruct blocks until all complete.
+    // Calling stop here sets channel.stopped and prevents destructor assertion.
+    channel_ptr->stop(error::invalid_magic);
+}
+
+BOOST_AUTO_TEST_CASE(channel_peer__notify__retained_relay_only__relay_subscriber)
+{
+    using namespace messages::peer;
+    const logger log{};
+    threadpool pool(2);
+    const settings set(bc::system::chain::selection::mainnet);
+    network::socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto channel_ptr = std::make_shared<mock_channel_peer>(log, socket_ptr, 42, set, options);
+
+    const auto data = serialize(inventory{}, level::maximum_protocol);
+    BOOST_REQUIRE(data);
+
+    frame in{};
+    in.head = heading::factory(set.identifier, inventory::command, *data);
+    const auto retained = to_shared<lazy>(in.head,
+        rpc::peer_registry::index_of<inventory>(), chunk_cptr{ data },
+        level::maximum_protocol, true);
+    in.payload = rpc::any_t{ lazy::cptr{ retained } };
+
+    lazy::cptr relayed{};
+    std::promise<code> notified;
+    boost::asio::post(channel_ptr->strand(), [&]() NOEXCEPT
+    {
+        channel_ptr->subscribe_relay([&](const code& ec, const lazy::cptr& message) NOEXCEPT
+        {
+            if (!ec) relayed = message;
+            return true;
+        });
+
+        notified.set_value(channel_ptr->notify(in));
+    });
+
+    BOOST_REQUIRE_EQUAL(notified.get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(relayed, retained);
+    channel_ptr->stop(error::invalid_magic);
+}
+
+BOOST_AUTO_TEST_CASE(channel_peer__notify__retained_invalid__not_relayed)
+{
+    using namespace messages::peer;
+    const logger log{};
+    threadpool pool(2);
+    const settings set(bc::system::chain::selection::mainnet);
+    network::socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto channel_ptr = std::make_shared<mock_channel_peer>(log, socket_ptr, 42, set, options);
+
+    const auto data = to_shared<data_chunk>(data_chunk{ 0x42 });
+
+    frame in{};
+    in.head = heading::factory(set.identifier, inventory::command, *data);
+    in.payload = rpc::any_t{ lazy::cptr{ to_shared<lazy>(in.head,
+        rpc::peer_registry::index_of<inventory>(), chunk_cptr{ data },
+        level::maximum_protocol, true) } };
+
+    auto relayed = false;
+    auto dispatched = false;
+    std::promise<code> notified;
+    boost::asio::post(channel_ptr->strand(), [&]() NOEXCEPT
+    {
+        channel_ptr->subscribe_relay([&](const code& ec, const lazy::cptr&) NOEXCEPT
+        {
+            if (!ec) relayed = true;
+            return true;
+        });
+
+        channel_ptr->subscribe<inventory>([&](const code& ec, const inventory::cptr&) NOEXCEPT
+        {
+            if (!ec) dispatched = true;
+            return true;
+        });
+
+        notified.set_value(channel_ptr->notify(in));
+    });
+
+    BOOST_REQUIRE_EQUAL(notified.get_future().get(), error::invalid_message);
+    BOOST_REQUIRE(!relayed);
+    BOOST_REQUIRE(!dispatched);
+    channel_ptr->stop(error::invalid_magic);
+}
+
 BOOST_AUTO_TEST_CASE(channel_peer__send__not_connected__expected)
 {
     const logger log{};
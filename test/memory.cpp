@@ -25,4 +25,61 @@ BOOST_AUTO_TEST_CASE(memory_test)
     BOOST_REQUIRE(true);
 }
 
+BOOST_AUTO_TEST_CASE(buffer_pool__fit__sufficient_capacity__resized_not_pooled)
+{
+    buffer_pool instance{};
+    system::data_chunk buffer(10);
+    instance.fit(buffer, 5);
+    BOOST_REQUIRE_EQUAL(buffer.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.stats().allocated, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__fit__insufficient_capacity__size_class_allocated)
+{
+    buffer_pool instance{};
+    system::data_chunk buffer{};
+    instance.fit(buffer, 5000);
+    BOOST_REQUIRE_EQUAL(buffer.size(), 5000u);
+    BOOST_REQUIRE_GE(buffer.capacity(), 8192u);
+    BOOST_REQUIRE_EQUAL(instance.stats().allocated, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__size_class__reused)
+{
+    buffer_pool instance{};
+    system::data_chunk buffer{};
+    instance.fit(buffer, 5000);
+    instance.release(buffer);
+    BOOST_REQUIRE(buffer.empty());
+    BOOST_REQUIRE_EQUAL(instance.stats().buffers, 1u);
+    BOOST_REQUIRE_GE(instance.stats().bytes, 8192u);
+
+    system::data_chunk other{};
+    instance.fit(other, 8000);
+    BOOST_REQUIRE_EQUAL(other.size(), 8000u);
+    BOOST_REQUIRE_EQUAL(instance.stats().reused, 1u);
+    BOOST_REQUIRE_EQUAL(instance.stats().buffers, 0u);
+    BOOST_REQUIRE_EQUAL(instance.stats().bytes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__small__discarded)
+{
+    buffer_pool instance{};
+    system::data_chunk buffer(42);
+    instance.release(buffer);
+    BOOST_REQUIRE(buffer.empty());
+    BOOST_REQUIRE_EQUAL(instance.stats().discarded, 1u);
+    BOOST_REQUIRE_EQUAL(instance.stats().buffers, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__over_limit__discarded)
+{
+    buffer_pool instance{ 4096 };
+    system::data_chunk buffer{};
+    instance.fit(buffer, 8192);
+    instance.release(buffer);
+    BOOST_REQUIRE_EQUAL(instance.stats().discarded, 1u);
+    BOOST_REQUIRE_EQUAL(instance.stats().bytes, 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <utility>
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(peer_benchmark_tests)
+
+#if defined(HAVE_SLOW_TESTS)
+
+using namespace system;
+using namespace network::messages::peer;
+using registry = rpc::peer_registry;
+using seconds_t = std::chrono::duration<double>;
+using corpus_t = std::map<size_t, std::vector<data_chunk>>;
+
+constexpr auto version = level::maximum_protocol;
+constexpr size_t megabyte = 1024u * 1024u;
+constexpr size_t volume = 64u * megabyte;
+
+// Captured corpus (optional): a file of concatenated v1 frames, as read from
+// mainnet peers. Otherwise the corpus is built from mainnet objects below.
+constexpr auto corpus_variable = "LIBBITCOIN_PEER_CORPUS";
+
+// Mainnet genesis header and its coinbase transaction.
+static const auto genesis_header = base16_chunk(
+    "0100000000000000000000000000000000000000000000000000000000000000"
+    "000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa"
+    "4b1e5e4a29ab5f49ffff001d1dac2b7c");
+static const auto genesis_coinbase = base16_chunk(
+    "01000000010000000000000000000000000000000000000000000000000000000000"
+    "000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32"
+    "303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e6420"
+    "6261696c6f757420666f722062616e6b73ffffffff0100f2052a0100000043410467"
+    "8afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc"
+    "3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000");
+
+// Each result is one json object per line (for regression tracking).
+static void report(const std::string& benchmark, const std::string& command,
+    double value, const std::string& unit)
+{
+    std::cout << R"({"suite":"peer","benchmark":")" << benchmark
+        << R"(","parameter":")" << command << R"(","value":)" << value
+        << R"(,"unit":")" << unit << R"("})" << std::endl;
+}
+
+template <typename Message>
+static void add(corpus_t& corpus, const Message& message)
+{
+    const auto data = serialize(message, version);
+    BOOST_REQUIRE(data);
+    corpus[registry::index_of<Message>()].push_back(*data);
+}
+
+static inventory make_inventory(size_t count)
+{
+    hashes items(count);
+    for (size_t index{}; index < count; ++index)
+        items.at(index).front() = static_cast<uint8_t>(index);
+
+    return inventory::factory(std::move(items),
+        inventory::type_id::witness_tx);
+}
+
+static corpus_t built_corpus()
+{
+    corpus_t corpus{};
+    const chain::header header{ genesis_header };
+    const auto coinbase = to_shared<chain::transaction>(genesis_coinbase,
+        true);
+
+    data_chunk block_data{ genesis_header };
+    block_data.push_back(0x01);
+    block_data.insert(block_data.end(), genesis_coinbase.begin(),
+        genesis_coinbase.end());
+
+    add(corpus, ping{ 0x0123456789abcdef });
+    add(corpus, pong{ 0x0123456789abcdef });
+    add(corpus, transaction{ coinbase });
+    add(corpus, headers{ chain::header_cptrs(max_get_headers,
+        to_shared(header)) });
+    add(corpus, address{ address_items(max_address) });
+    add(corpus, make_inventory(one));
+    add(corpus, make_inventory(500));
+    add(corpus, make_inventory(max_inventory));
+    add(corpus, get_data{ make_inventory(1000).items });
+    add(corpus, not_found{ make_inventory(100).items });
+    corpus[registry::index_of<block>()].push_back(block_data);
+    return corpus;
+}
+
+static corpus_t captured_corpus(const char* path)
+{
+    std::ifstream file{ path, std::ios::binary };
+    const data_chunk data(std::istreambuf_iterator<char>{ file },
+        std::istreambuf_iterator<char>{});
+    const std::span<const uint8_t> frames{ data };
+
+    corpus_t corpus{};
+    for (size_t start{}; start + heading::size() <= data.size();)
+    {
+        const auto head = heading::deserialize(frames.subspan(start));
+        if (!head)
+            break;
+
+        const auto begin = start + heading::size();
+        const auto end = begin + head->payload_size;
+        if (end > data.size())
+            break;
+
+        // Payloads invalid in this context are excluded.
+        const auto index = head->index();
+        const auto payload = frames.subspan(begin, head->payload_size);
+        if (registry::to_any(index, payload, version, true))
+            corpus[index].emplace_back(payload.begin(), payload.end());
+
+        start = end;
+    }
+
+    return corpus;
+}
+
+// Stream comparison over the reader deserializer of each message.
+// ----------------------------------------------------------------------------
+
+using baseline_t = bool(*)(const data_chunk&);
+
+template <typename Stream, typename Reader, size_t Index>
+static bool reader_deserialize(const data_chunk& payload)
+{
+    using message = registry::message_t<Index>;
+    Stream stream{ payload };
+    Reader reader{ stream };
+
+    if constexpr (requires { message::deserialize(version, reader, true); })
+        std::ignore = message::deserialize(version, reader, true);
+    else
+        std::ignore = message::deserialize(version, reader);
+
+    return reader;
+}
+
+template <typename Stream, typename Reader, size_t... Index>
+static constexpr auto make_readers(std::index_sequence<Index...>)
+{
+    return std::array<baseline_t, sizeof...(Index)>
+    {
+        &reader_deserialize<Stream, Reader, Index>...
+    };
+}
+
+static const auto istream_readers = make_readers<system::istream,
+    system::byte_reader>(std::make_index_sequence<registry::size>{});
+static const auto fast_readers = make_readers<system::stream::in::fast,
+    system::read::bytes::fast>(std::make_index_sequence<registry::size>{});
+
+template <typename Function>
+static void measure(const std::string& benchmark, size_t index,
+    const std::vector<data_chunk>& payloads, Function&& deserialize)
+{
+    size_t bytes{};
+    for (const auto& payload: payloads)
+        bytes += payload.size();
+
+    const auto rounds = std::clamp<size_t>(volume / std::max(bytes, one),
+        10, 100'000);
+
+    size_t valid{};
+    const auto start = steady_clock::now();
+    for (size_t round{}; round < rounds; ++round)
+        for (const auto& payload: payloads)
+            if (deserialize(payload))
+                ++valid;
+
+    const seconds_t elapsed{ steady_clock::now() - start };
+    BOOST_REQUIRE_EQUAL(valid, rounds * payloads.size());
+
+    const std::string command{ registry::commands().at(index) };
+    const auto messages = static_cast<double>(rounds * payloads.size());
+    report(benchmark, command, messages / elapsed.count(), "messages/s");
+    report(benchmark, command, static_cast<double>(rounds * bytes) /
+        megabyte / elapsed.count(), "MiB/s");
+}
+
+BOOST_AUTO_TEST_CASE(peer_benchmark__deserialize__corpus)
+{
+    const auto path = std::getenv(corpus_variable);
+    const auto corpus = is_null(path) ? built_corpus() : captured_corpus(path);
+    BOOST_REQUIRE(!corpus.empty());
+
+    for (const auto& [index, payloads]: corpus)
+    {
+        measure("istream", index, payloads, istream_readers.at(index));
+        measure("fast", index, payloads, fast_readers.at(index));
+        measure("registry", index, payloads, [&](const data_chunk& payload)
+        {
+            return !!registry::to_any(index, payload, version, true);
+        });
+    }
+}
+
+#endif // HAVE_SLOW_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -273,7 +273,8 @@ BOOST_AUTO_TEST_CASE(peer_body__put__checksum_disabled__message)
 }
 
 // The framed reader parses the caller buffer supplied at construct, which is
-// how socket::peer_read drives it (the buffer is not consumed by the parse).
+// how socket::peer_read drives it (the buffer is not consumed by the parse,
+// unless taken by a message that owns its payload).
 
 static data_chunk block_frame()
 {
@@ -401,6 +402,153 @@ BOOST_AUTO_TEST_CASE(peer_body__put__framed_buffer_block__message)
     BOOST_REQUIRE(message->block.is_valid());
 }
 
+BOOST_AUTO_TEST_CASE(peer_body__put__framed_buffer_block__buffer_taken)
+{
+    const auto data = block_frame();
+    const auto head = frame_head(data);
+    const auto payload = frame_payload(data);
+    auto buffer = payload;
+
+    auto value = test_frame();
+    boost_code ec{};
+    body::reader reader{ value, buffer };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ buffer.data(), buffer.size() }, ec);
+    BOOST_REQUIRE(reader.done());
+
+    // The block owns the payload, taken from the caller buffer (no copy).
+    BOOST_REQUIRE(buffer.empty());
+    const auto message = value.payload.get<const block>();
+    BOOST_REQUIRE(message);
+    BOOST_REQUIRE_EQUAL(message->block.to_data(true), payload);
+}
+
+BOOST_AUTO_TEST_CASE(peer_body__put__framed_buffer_block_excess_capacity__buffer_copied)
+{
+    const auto data = block_frame();
+    const auto head = frame_head(data);
+    const auto payload = frame_payload(data);
+    data_chunk buffer{};
+    buffer.reserve(2u * payload.size());
+    buffer.assign(payload.begin(), payload.end());
+    const auto capacity = buffer.capacity();
+
+    auto value = test_frame();
+    boost_code ec{};
+    body::reader reader{ value, buffer };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ buffer.data(), buffer.size() }, ec);
+    BOOST_REQUIRE(reader.done());
+
+    // The block owns an exact copy, the (pooled) caller buffer is not taken.
+    BOOST_REQUIRE_EQUAL(buffer.capacity(), capacity);
+    const auto message = value.payload.get<const block>();
+    BOOST_REQUIRE(message);
+    BOOST_REQUIRE_EQUAL(message->block.to_data(true), payload);
+}
+
+BOOST_AUTO_TEST_CASE(peer_body__put__relay_framed_buffer_inventory__retained_buffer_taken)
+{
+    inventory inv{};
+    inv.items.emplace_back(inventory_item{ inventory_item::type_id::witness_tx, system::null_hash });
+    const auto data = serialize(inv, magic, messages::peer::level::bip31);
+    BOOST_REQUIRE(data);
+    const auto head = frame_head(*data);
+    const auto payload = frame_payload(*data);
+    auto buffer = payload;
+
+    auto value = test_frame();
+    value.relay = true;
+    boost_code ec{};
+    body::reader reader{ value, buffer };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ buffer.data(), buffer.size() }, ec);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE(reader.done());
+
+    // The payload is retained as read (taken), deserialized upon access.
+    BOOST_REQUIRE(buffer.empty());
+    BOOST_REQUIRE(!value.payload.get<const inventory>());
+    const auto retained = value.payload.get<const lazy>();
+    BOOST_REQUIRE(retained);
+    BOOST_REQUIRE_EQUAL(*retained->payload(), payload);
+    BOOST_REQUIRE_EQUAL(retained->head().command, inventory::command);
+    BOOST_REQUIRE(retained->get<inventory>()->items == inv.items);
+}
+
+BOOST_AUTO_TEST_CASE(peer_body__put__relay_inventory_excess_capacity__retained_buffer_copied)
+{
+    inventory inv{};
+    inv.items.emplace_back(inventory_item{ inventory_item::type_id::witness_tx, system::null_hash });
+    const auto data = serialize(inv, magic, messages::peer::level::bip31);
+    BOOST_REQUIRE(data);
+    const auto head = frame_head(*data);
+    const auto payload = frame_payload(*data);
+    data_chunk buffer{};
+    buffer.reserve(2u * payload.size());
+    buffer.assign(payload.begin(), payload.end());
+    const auto capacity = buffer.capacity();
+
+    auto value = test_frame();
+    value.relay = true;
+    boost_code ec{};
+    body::reader reader{ value, buffer };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ buffer.data(), buffer.size() }, ec);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE(reader.done());
+
+    // The retained payload is an exact copy, the caller buffer is not taken.
+    BOOST_REQUIRE_EQUAL(buffer.capacity(), capacity);
+    const auto retained = value.payload.get<const lazy>();
+    BOOST_REQUIRE(retained);
+    BOOST_REQUIRE_EQUAL(*retained->payload(), payload);
+    BOOST_REQUIRE_EQUAL(retained->payload()->capacity(), payload.size());
+}
+
+BOOST_AUTO_TEST_CASE(peer_body__put__relay_malformed_inventory__invalid_message)
+{
+    // Two items are declared and one is present.
+    const auto payload = base16_chunk("02"
+        "01000000"
+        "0000000000000000000000000000000000000000000000000000000000000000");
+    data_chunk head(heading::size());
+    BOOST_REQUIRE(heading::factory(magic, inventory::command, payload).serialize(head));
+
+    auto value = test_frame();
+    value.relay = true;
+    boost_code ec{};
+    body::reader reader{ value };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ payload.data(), payload.size() }, ec);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE_EQUAL(value.fault, error::invalid_message);
+    BOOST_REQUIRE(!value.payload);
+}
+
+BOOST_AUTO_TEST_CASE(peer_body__put__relay_ping__not_retained)
+{
+    const auto data = ping_frame();
+    const auto head = frame_head(data);
+    const auto payload = frame_payload(data);
+
+    auto value = test_frame();
+    value.relay = true;
+    boost_code ec{};
+    body::reader reader{ value };
+    reader.init({}, ec);
+    reader.put({ head.data(), head.size() }, ec);
+    reader.put({ payload.data(), payload.size() }, ec);
+    BOOST_REQUIRE(reader.done());
+    BOOST_REQUIRE(!value.payload.get<const lazy>());
+    BOOST_REQUIRE(value.payload.get<const ping>());
+}
+
 BOOST_AUTO_TEST_CASE(peer_body__writer__frame__emitted)
 {
     auto value = test_frame();
@@ -423,6 +571,24 @@ BOOST_AUTO_TEST_CASE(peer_body__writer__frame__emitted)
     BOOST_REQUIRE_EQUAL(out->first.size(), value.data->size());
 }
 
+BOOST_AUTO_TEST_CASE(peer_body__writer__retained__frame_as_read)
+{
+    const auto data = ping_frame();
+    const auto head = heading::factory(magic, ping::command, frame_payload(data));
+    const auto retained = system::to_shared<lazy>(head, rpc::peer_registry::index_of<ping>(),
+        system::to_shared<data_chunk>(frame_payload(data)), messages::peer::level::bip31, true);
+
+    auto value = test_frame();
+    value.message = rpc::any_t{ lazy::cptr{ retained } };
+    value.index = retained->index();
+
+    boost_code ec{};
+    body::writer writer{ value };
+    writer.init(ec);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE_EQUAL(*value.data, data);
+}
+
 BOOST_AUTO_TEST_CASE(peer_body__writer__get_twice__empty)
 {
     auto value = test_frame();
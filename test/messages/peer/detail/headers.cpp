@@ -200,6 +200,26 @@ BOOST_AUTO_TEST_CASE(headers__deserialize2__default_header__expected)
     BOOST_REQUIRE(*message.header_ptrs.front() == *expected.header_ptrs.front());
 }
 
+BOOST_AUTO_TEST_CASE(headers__deserialize2__headers__contiguous)
+{
+    const auto data = base16_chunk("02"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0a0000002a00000000000000000000000000000000000000000000000000000000000000180000000"
+        "0000000000000000000000000000000000000000000000000000000221b08003e8a6300240c010000");
+    system::read::bytes::copy source(data);
+    const auto message = headers::deserialize(level::headers_protocol, source);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(message.header_ptrs.size(), two);
+
+    // Headers are adjacent elements of one block, sharing its ownership.
+    const auto& first_ptr = message.header_ptrs.front();
+    const auto& second_ptr = message.header_ptrs.back();
+    BOOST_REQUIRE_EQUAL(std::next(first_ptr.get()), second_ptr.get());
+    BOOST_REQUIRE(!first_ptr.owner_before(second_ptr));
+    BOOST_REQUIRE(!second_ptr.owner_before(first_ptr));
+}
+
 BOOST_AUTO_TEST_CASE(headers__deserialize1__underflow__nullptr)
 {
     const auto data = base16_chunk("01");
@@ -240,4 +260,72 @@ BOOST_AUTO_TEST_CASE(headers__deserialize1__headers__expected)
     BOOST_REQUIRE(*message->header_ptrs.back() == *expected.header_ptrs.back());
 }
 
+BOOST_AUTO_TEST_CASE(headers__deserialize1__headers__contiguous_hashed)
+{
+    const chain::header second
+    {
+        10,
+        { 42 },
+        { 24 },
+        531234,
+        6523454,
+        68644
+    };
+
+    const auto data = base16_chunk("02"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0a0000002a00000000000000000000000000000000000000000000000000000000000000180000000"
+        "0000000000000000000000000000000000000000000000000000000221b08003e8a6300240c010000");
+    const auto message = headers::deserialize(level::headers_protocol, data);
+    BOOST_REQUIRE(message);
+    BOOST_REQUIRE_EQUAL(message->header_ptrs.size(), two);
+
+    // Headers are adjacent elements of one block, sharing its ownership.
+    const auto& first_ptr = message->header_ptrs.front();
+    const auto& second_ptr = message->header_ptrs.back();
+    BOOST_REQUIRE_EQUAL(std::next(first_ptr.get()), second_ptr.get());
+    BOOST_REQUIRE(!first_ptr.owner_before(second_ptr));
+    BOOST_REQUIRE(!second_ptr.owner_before(first_ptr));
+
+    // Hashes are set from the wire bytes.
+    BOOST_REQUIRE_EQUAL(first_ptr->hash(), chain::header{}.hash());
+    BOOST_REQUIRE_EQUAL(second_ptr->hash(), second.hash());
+}
+
+BOOST_AUTO_TEST_CASE(headers__deserialize1__trail_missing__nullptr)
+{
+    const auto data = base16_chunk("01"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "000000000000000000000000000000000000000000000000000000000000000000000000000000042");
+    const auto message = headers::deserialize(level::headers_protocol, data);
+    BOOST_REQUIRE(!message);
+}
+
+#if defined(HAVE_SLOW_TESTS)
+
+BOOST_AUTO_TEST_CASE(headers__deserialize1__benchmark__maximum_headers)
+{
+    constexpr size_t rounds = 1'000;
+    const headers message
+    {
+        chain::header_cptrs(max_get_headers, to_shared<chain::header>())
+    };
+
+    data_chunk data(message.size(level::headers_protocol));
+    BOOST_REQUIRE(message.serialize(level::headers_protocol, data));
+
+    const auto start = steady_clock::now();
+    for (size_t round{}; round < rounds; ++round)
+    {
+        const auto out = headers::deserialize(level::headers_protocol, data);
+        BOOST_REQUIRE(out);
+    }
+
+    const std::chrono::duration<double> elapsed{ steady_clock::now() - start };
+    BOOST_TEST_MESSAGE("2000 header messages/sec: " << rounds / elapsed.count());
+}
+
+#endif // HAVE_SLOW_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
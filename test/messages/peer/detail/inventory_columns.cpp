@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(p2p_inventory_columns_tests)
+
+using namespace system;
+using namespace network::messages::peer;
+
+using type_id = inventory_item::type_id;
+
+constexpr auto version = level::maximum_protocol;
+
+// Mixed types, repeated to span full and partial lanes.
+static inventory make_mixed_inventory(size_t repeat) NOEXCEPT
+{
+    static const std::array<type_id, 10> types
+    {
+        type_id::transaction,
+        type_id::block,
+        type_id::witness_tx,
+        type_id::witness_block,
+        type_id::filtered,
+        type_id::wtxid,
+        type_id::compact,
+        type_id::witness_filtered,
+        type_id::witness_compact,
+        type_id::error
+    };
+
+    inventory value{};
+    for (size_t index = 0; index < repeat * types.size() + 3u; ++index)
+    {
+        hash_digest hash{};
+        hash.front() = static_cast<uint8_t>(index);
+        hash.back() = static_cast<uint8_t>(index >> 8);
+        value.items.push_back({ types.at(index % types.size()), hash });
+    }
+
+    return value;
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__factory__mixed__expected_rows)
+{
+    const auto inv = make_mixed_inventory(3);
+    const auto columns = inventory_columns::factory(inv.items);
+    BOOST_REQUIRE_EQUAL(columns.rows(), inv.items.size());
+    BOOST_REQUIRE_EQUAL(columns.types.size(), columns.hashes.size());
+    BOOST_REQUIRE(columns.to_items() == inv.items);
+    BOOST_REQUIRE(columns.at(5) == inv.items.at(5));
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__deserialize__inventory_payload__round_trip)
+{
+    const auto inv = make_mixed_inventory(5);
+    const auto data = serialize(inv, version);
+    BOOST_REQUIRE(data);
+
+    const auto columns = inventory_columns::deserialize(version, *data);
+    BOOST_REQUIRE(columns);
+    BOOST_REQUIRE(columns->to_items() == inv.items);
+    BOOST_REQUIRE_EQUAL(columns->size(version), data->size());
+
+    data_chunk out(columns->size(version));
+    BOOST_REQUIRE(columns->serialize(version, out));
+    BOOST_REQUIRE_EQUAL(out, *data);
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__deserialize__get_data_payload__round_trip)
+{
+    const auto inv = make_mixed_inventory(2);
+    const auto data = serialize(get_data{ inv.items }, version);
+    BOOST_REQUIRE(data);
+
+    const auto columns = inventory_columns::deserialize(version, *data);
+    BOOST_REQUIRE(columns);
+    BOOST_REQUIRE(columns->to_items() == inv.items);
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__deserialize__truncated__nullptr)
+{
+    auto data = *serialize(make_mixed_inventory(1), version);
+    data.pop_back();
+    BOOST_REQUIRE(!inventory_columns::deserialize(version, data));
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__view__always__hashes_in_place)
+{
+    const auto columns = inventory_columns::factory(make_mixed_inventory(1).items);
+    const auto view = columns.view();
+    BOOST_REQUIRE_EQUAL(view.size(), columns.rows());
+    BOOST_REQUIRE_EQUAL(view.data(), columns.hashes.data());
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__all__uniform_and_mixed__expected)
+{
+    const auto rows = make_mixed_inventory(2).items.size();
+    const auto uniform = inventory_columns::factory(inventory::factory(
+        hashes(rows), type_id::witness_tx).items);
+    BOOST_REQUIRE(uniform.all(type_id::witness_tx));
+    BOOST_REQUIRE(!uniform.all(type_id::transaction));
+    BOOST_REQUIRE(inventory_columns{}.all(type_id::block));
+
+    const auto mixed = inventory_columns::factory(make_mixed_inventory(2).items);
+    BOOST_REQUIRE(!mixed.all(type_id::witness_tx));
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__queries__mixed__same_as_inventory)
+{
+    for (const size_t repeat: { 0, 1, 4, 33 })
+    {
+        const auto inv = make_mixed_inventory(repeat);
+        const auto columns = inventory_columns::factory(inv.items);
+
+        for (const auto type: { type_id::error, type_id::transaction,
+            type_id::block, type_id::filtered, type_id::compact,
+            type_id::wtxid, type_id::witness_tx, type_id::witness_block,
+            type_id::witness_filtered, type_id::witness_compact })
+        {
+            BOOST_REQUIRE_EQUAL(columns.count(type), inv.count(type));
+            BOOST_REQUIRE_EQUAL(columns.any(type), inv.any(type));
+            BOOST_REQUIRE(columns.to_hashes(type) == inv.to_hashes(type));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(inventory_columns__any__empty__false)
+{
+    const inventory_columns columns{};
+    BOOST_REQUIRE(!columns.any(type_id::block));
+    BOOST_REQUIRE(columns.to_hashes(type_id::block).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(p2p_priority_tests)
+
+using namespace network::messages::peer;
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__unassigned__control)
+{
+    static_assert(to_priority(identifiers::unassigned) == priority::control);
+    BOOST_REQUIRE(to_priority(identifiers::unassigned) == priority::control);
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__control__control)
+{
+    BOOST_REQUIRE(to_priority(ping::identifier) == priority::control);
+    BOOST_REQUIRE(to_priority(pong::identifier) == priority::control);
+    BOOST_REQUIRE(to_priority(get_data::identifier) == priority::control);
+    BOOST_REQUIRE(to_priority(get_headers::identifier) == priority::control);
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__announce__announce)
+{
+    BOOST_REQUIRE(to_priority(inventory::identifier) == priority::announce);
+    BOOST_REQUIRE(to_priority(address::identifier) == priority::announce);
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__bulk__bulk)
+{
+    BOOST_REQUIRE(to_priority(block::identifier) == priority::bulk);
+    BOOST_REQUIRE(to_priority(transaction::identifier) == priority::bulk);
+    BOOST_REQUIRE(to_priority(merkle_block::identifier) == priority::bulk);
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__headers_compact_block__control)
+{
+    // Not queued behind blocks, and not droppable.
+    BOOST_REQUIRE(to_priority(headers::identifier) == priority::control);
+    BOOST_REQUIRE(to_priority(compact_block::identifier) == priority::control);
+    BOOST_REQUIRE(!is_droppable(to_priority(headers::identifier)));
+    BOOST_REQUIRE(!is_droppable(to_priority(compact_block::identifier)));
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__is_droppable__announce_only__true)
+{
+    static_assert(is_droppable(priority::announce));
+    BOOST_REQUIRE(is_droppable(priority::announce));
+    BOOST_REQUIRE(!is_droppable(priority::control));
+    BOOST_REQUIRE(!is_droppable(priority::bulk));
+}
+
+BOOST_AUTO_TEST_CASE(p2p_priority__to_priority__not_found__bulk)
+{
+    // A notfound cannot overtake the responses to the same request.
+    BOOST_REQUIRE(to_priority(not_found::identifier) == priority::bulk);
+    BOOST_REQUIRE(to_priority(not_found::identifier) ==
+        to_priority(block::identifier));
+    BOOST_REQUIRE(to_priority(not_found::identifier) ==
+        to_priority(transaction::identifier));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
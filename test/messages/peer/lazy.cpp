@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(peer_lazy_tests)
+
+using namespace network::messages::peer;
+using namespace bc::system;
+using registry = rpc::peer_registry;
+
+constexpr uint32_t magic = 0xd9b4bef9;
+constexpr auto version = level::maximum_protocol;
+
+static inventory test_inventory() NOEXCEPT
+{
+    inventory inv{};
+    inv.items.emplace_back(inventory_item{ inventory_item::type_id::block,
+        base16_hash("00000000000000000000000000000000000000000000000000000000000000ff") });
+    inv.items.emplace_back(inventory_item{ inventory_item::type_id::witness_tx,
+        base16_hash("000000000000000000000000000000000000000000000000000000000000ee00") });
+    return inv;
+}
+
+static lazy::cptr test_lazy(uint32_t read_version=version,
+    bool witness=true) NOEXCEPT
+{
+    const auto inv = test_inventory();
+    const auto data = serialize(inv, read_version);
+    BOOST_REQUIRE(data);
+
+    const auto head = heading::factory(magic, inventory::command, *data);
+    return to_shared<lazy>(head, registry::index_of<inventory>(),
+        chunk_cptr{ data }, read_version, witness);
+}
+
+BOOST_AUTO_TEST_CASE(lazy__relayable__relay_messages__true)
+{
+    BOOST_REQUIRE(lazy::relayable(registry::index_of<transaction>()));
+    BOOST_REQUIRE(lazy::relayable(registry::index_of<inventory>()));
+    BOOST_REQUIRE(lazy::relayable(registry::index_of<address>()));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__relayable__other_messages__false)
+{
+    BOOST_REQUIRE(!lazy::relayable(registry::index_of<ping>()));
+    BOOST_REQUIRE(!lazy::relayable(registry::index_of<block>()));
+    BOOST_REQUIRE(!lazy::relayable(registry::unknown));
+}
+
+// Version 1, one input (null point, empty script), one output (empty script).
+const auto plain_tx = base16_chunk(
+    "01000000"
+    "01"
+    "0000000000000000000000000000000000000000000000000000000000000000ffffffff"
+    "00"
+    "ffffffff"
+    "01"
+    "0000000000000000"
+    "00"
+    "00000000");
+
+// As above, segregated (bip144) with one witness element of one byte.
+const auto witness_tx = base16_chunk(
+    "01000000"
+    "0001"
+    "01"
+    "0000000000000000000000000000000000000000000000000000000000000000ffffffff"
+    "00"
+    "ffffffff"
+    "01"
+    "0000000000000000"
+    "00"
+    "010142"
+    "00000000");
+
+BOOST_AUTO_TEST_CASE(lazy__structured__inventory__expected)
+{
+    const auto data = serialize(test_inventory(), version);
+    BOOST_REQUIRE(data);
+    const auto index = registry::index_of<inventory>();
+    BOOST_REQUIRE(lazy::structured(index, *data, version, true));
+
+    auto truncated = *data;
+    truncated.pop_back();
+    BOOST_REQUIRE(!lazy::structured(index, truncated, version, true));
+
+    auto extended = *data;
+    extended.push_back(0x00);
+    BOOST_REQUIRE(!lazy::structured(index, extended, version, true));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__structured__address__expected)
+{
+    address message{};
+    message.addresses.push_back(address_item{});
+    const auto data = serialize(message, version);
+    BOOST_REQUIRE(data);
+    const auto index = registry::index_of<address>();
+    BOOST_REQUIRE(lazy::structured(index, *data, version, true));
+
+    auto truncated = *data;
+    truncated.pop_back();
+    BOOST_REQUIRE(!lazy::structured(index, truncated, version, true));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__structured__transaction__expected)
+{
+    const auto index = registry::index_of<transaction>();
+    BOOST_REQUIRE(lazy::structured(index, plain_tx, version, true));
+    BOOST_REQUIRE(lazy::structured(index, plain_tx, version, false));
+    BOOST_REQUIRE(lazy::structured(index, witness_tx, version, true));
+    BOOST_REQUIRE(transaction::deserialize(version, plain_tx, true));
+    BOOST_REQUIRE(transaction::deserialize(version, witness_tx, true));
+
+    auto truncated = witness_tx;
+    truncated.pop_back();
+    BOOST_REQUIRE(!lazy::structured(index, truncated, version, true));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__structured__other_type__false)
+{
+    const auto data = serialize(ping{ 42 }, version);
+    BOOST_REQUIRE(data);
+    BOOST_REQUIRE(!lazy::structured(registry::index_of<ping>(), *data, version, true));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__get__retained_type__parsed_once)
+{
+    const auto instance = test_lazy();
+    const auto message = instance->get<inventory>();
+    BOOST_REQUIRE(message);
+    BOOST_REQUIRE(message->items == test_inventory().items);
+    BOOST_REQUIRE_EQUAL(instance->get<inventory>(), message);
+}
+
+BOOST_AUTO_TEST_CASE(lazy__get__other_type__nullptr)
+{
+    BOOST_REQUIRE(!test_lazy()->get<transaction>());
+}
+
+BOOST_AUTO_TEST_CASE(lazy__get__invalid_payload__nullptr)
+{
+    const auto head = heading::factory(magic, inventory::command, data_chunk{ 0x42 });
+    const lazy instance{ head, registry::index_of<inventory>(),
+        to_shared<data_chunk>(data_chunk{ 0x42 }), version, true };
+    BOOST_REQUIRE(!instance.get<inventory>());
+}
+
+BOOST_AUTO_TEST_CASE(lazy__to_columns__inventory__expected)
+{
+    const auto columns = test_lazy()->to_columns();
+    BOOST_REQUIRE(columns);
+    BOOST_REQUIRE(columns->to_items() == test_inventory().items);
+}
+
+BOOST_AUTO_TEST_CASE(lazy__to_columns__invalid_payload__nullptr)
+{
+    const auto head = heading::factory(magic, inventory::command, data_chunk{ 0x42 });
+    const lazy instance{ head, registry::index_of<inventory>(),
+        to_shared<data_chunk>(data_chunk{ 0x42 }), version, true };
+    BOOST_REQUIRE(!instance.to_columns());
+}
+
+BOOST_AUTO_TEST_CASE(lazy__to_columns__other_type__nullptr)
+{
+    const address message{};
+    const auto data = serialize(message, version);
+    BOOST_REQUIRE(data);
+
+    const auto head = heading::factory(magic, address::command, *data);
+    const lazy instance{ head, registry::index_of<address>(),
+        chunk_cptr{ data }, version, true };
+    BOOST_REQUIRE(!instance.to_columns());
+}
+
+BOOST_AUTO_TEST_CASE(lazy__reusable__inventory__witness_only)
+{
+    const auto instance = test_lazy();
+    BOOST_REQUIRE(instance->reusable(version));
+    BOOST_REQUIRE(instance->reusable(level::bip31));
+    BOOST_REQUIRE(!instance->reusable(version, false));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__reusable__address__version_and_witness)
+{
+    const address message{};
+    const auto data = serialize(message, version);
+    BOOST_REQUIRE(data);
+
+    const auto head = heading::factory(magic, address::command, *data);
+    const lazy instance{ head, registry::index_of<address>(),
+        chunk_cptr{ data }, version, true };
+    BOOST_REQUIRE(instance.reusable(version));
+    BOOST_REQUIRE(!instance.reusable(level::bip31));
+    BOOST_REQUIRE(!instance.reusable(version, false));
+}
+
+BOOST_AUTO_TEST_CASE(lazy__message__retained_type__shared_with_get)
+{
+    const auto instance = test_lazy();
+    const auto& message = instance->message();
+    BOOST_REQUIRE(message);
+    BOOST_REQUIRE_EQUAL(message.get<const inventory>(), instance->get<inventory>());
+}
+
+BOOST_AUTO_TEST_CASE(lazy__to_frame__always__serialized_frame)
+{
+    const auto expected = serialize(test_inventory(), magic, version);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_EQUAL(*test_lazy()->to_frame(magic), *expected);
+}
+
+BOOST_AUTO_TEST_CASE(lazy__registry__reusable__payload_as_read)
+{
+    const auto instance = test_lazy();
+    const rpc::any_t message{ instance };
+    const auto index = instance->index();
+    const auto& payload = *instance->payload();
+
+    BOOST_REQUIRE_EQUAL(registry::to_payload_size(index, message, version), payload.size());
+    BOOST_REQUIRE_EQUAL(*registry::to_payload(index, message, version), payload);
+    BOOST_REQUIRE_EQUAL(*registry::to_frame(index, message, magic, version), *instance->to_frame(magic));
+
+    data_chunk out(payload.size());
+    BOOST_REQUIRE(registry::to_payload(index, message, version, out));
+    BOOST_REQUIRE_EQUAL(out, payload);
+}
+
+BOOST_AUTO_TEST_CASE(lazy__registry__not_reusable__reserialized)
+{
+    // Not read as witness (writes are always witness).
+    const auto instance = test_lazy(version, false);
+    const rpc::any_t message{ instance };
+    const auto index = instance->index();
+    const auto expected = serialize(test_inventory(), magic, version);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE(!instance->reusable(version));
+
+    BOOST_REQUIRE_EQUAL(*registry::to_frame(index, message, magic, version), *expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -143,6 +143,26 @@ BOOST_AUTO_TEST_CASE(dispatcher__subscribe__multiple__expected)
     instance.stop(error::service_stopped);
 }
 
+BOOST_AUTO_TEST_CASE(dispatcher__subscribed__subscribe__expected)
+{
+    distributor_mock instance{};
+    BOOST_REQUIRE(!instance.subscribed("all_required"));
+    BOOST_REQUIRE(!instance.subscribed("empty_method"));
+    BOOST_REQUIRE(!instance.subscribed("unknown_method"));
+
+    const auto ec = instance.subscribe(
+        [&](const code&, mock_interface::all_required, bool, double, std::string)
+        {
+            return true;
+        });
+
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE(instance.subscribed("all_required"));
+    BOOST_REQUIRE(!instance.subscribed("empty_method"));
+    instance.stop(error::service_stopped);
+    BOOST_REQUIRE(!instance.subscribed("all_required"));
+}
+
 BOOST_AUTO_TEST_CASE(dispatcher__notify__unknown_method__unexpected_method)
 {
     distributor_mock instance{};
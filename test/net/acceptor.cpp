@@ -36,11 +36,21 @@ public:
         return strand_;
     }
 
+    const asio::strand& get_shard() const NOEXCEPT
+    {
+        return shard_;
+    }
+
     const asio::acceptor& get_acceptor() const NOEXCEPT
     {
         return acceptor_;
     }
 
+    code start_endpoint(const asio::endpoint& point) NOEXCEPT
+    {
+        return start(point);
+    }
+
     size_t get_maximum_request() const NOEXCEPT
     {
         return parameters_.maximum_request;
@@ -71,6 +81,53 @@ BOOST_AUTO_TEST_CASE(acceptor__construct__default__stopped_expected)
     BOOST_REQUIRE_EQUAL(instance->get_maximum_request(), maximum);
 }
 
+BOOST_AUTO_TEST_CASE(acceptor__construct__two__distinct_shard_strands)
+{
+    const logger log{};
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+    auto instance1 = std::make_shared<accessor>(log, strand, pool.service(), suspended, acceptor::parameters{});
+    auto instance2 = std::make_shared<accessor>(log, strand, pool.service(), suspended, acceptor::parameters{});
+
+    BOOST_REQUIRE(&instance1->get_strand() == &instance2->get_strand());
+    BOOST_REQUIRE(instance1->get_shard() != strand);
+    BOOST_REQUIRE(instance2->get_shard() != strand);
+    BOOST_REQUIRE(instance1->get_shard() != instance2->get_shard());
+}
+
+#if defined(HAVE_LINUX) && defined(SO_REUSEPORT)
+BOOST_AUTO_TEST_CASE(acceptor__start__reuse_port_shared_bind__success)
+{
+    const logger log{};
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+    const acceptor::parameters params{ .tuning = { .reuse_port = true } };
+    auto instance1 = std::make_shared<accessor>(log, strand, pool.service(), suspended, acceptor::parameters{ params });
+    auto instance2 = std::make_shared<accessor>(log, strand, pool.service(), suspended, acceptor::parameters{ params });
+
+    const asio::endpoint bind{ asio::ipv4::loopback(), 0 };
+    BOOST_REQUIRE_EQUAL(instance1->start_endpoint(bind), error::success);
+
+    // The second shard binds the (ephemeral) port of the first.
+    const auto shared = instance1->get_acceptor().local_endpoint();
+    BOOST_REQUIRE_EQUAL(instance2->start_endpoint(shared), error::success);
+    BOOST_REQUIRE(instance2->get_acceptor().local_endpoint() == shared);
+
+    boost::asio::post(strand, [=]() NOEXCEPT
+    {
+        instance1->stop();
+        instance2->stop();
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance1->get_stopped());
+    BOOST_REQUIRE(instance2->get_stopped());
+}
+#endif
+
 // TODO: There is no way to fake failures in start.
 BOOST_AUTO_TEST_CASE(acceptor__start__stop__success)
 {
@@ -0,0 +1,395 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include "../test.hpp"
+
+#if defined(HAVE_LINUX)
+    #include <sys/resource.h>
+#endif
+
+BOOST_AUTO_TEST_SUITE(net_benchmark_tests)
+
+#if defined(HAVE_SLOW_TESTS)
+
+using tcp_socket = boost::asio::ip::tcp::socket;
+using tcp_acceptor = boost::asio::ip::tcp::acceptor;
+using seconds_t = std::chrono::duration<double>;
+using microseconds_t = std::chrono::duration<double, std::micro>;
+using system::data_chunk;
+
+constexpr size_t threads = 4;
+constexpr size_t round_trips = 100;
+constexpr size_t megabyte = 1024u * 1024u;
+constexpr size_t volume = 256u * megabyte;
+const std::vector<size_t> scales{ 100, 1'000, 4'000 };
+
+// The reactor is fixed at compile time (see boost.hpp).
+#if defined(HAVE_IO_URING)
+    constexpr auto backend = "io_uring";
+#else
+    constexpr auto backend = "epoll";
+#endif
+
+// Each result is one json object per line (for regression tracking).
+static void report(const std::string& benchmark, size_t connections,
+    size_t parameter, double value, const std::string& unit)
+{
+    std::cout << R"({"suite":"net","backend":")" << backend
+        << R"(","benchmark":")" << benchmark
+        << R"(","connections":)" << connections
+        << R"(,"parameter":)" << parameter << R"(,"value":)" << value
+        << R"(,"unit":")" << unit << R"("})" << std::endl;
+}
+
+// Both ends are in process, so each connection requires two descriptors.
+static size_t capped(size_t connections)
+{
+    constexpr size_t reserve = 64;
+    static const auto limit = []()
+    {
+#if defined(HAVE_LINUX)
+        rlimit value{};
+        if (is_zero(::getrlimit(RLIMIT_NOFILE, &value)))
+        {
+            value.rlim_cur = value.rlim_max;
+            ::setrlimit(RLIMIT_NOFILE, &value);
+            ::getrlimit(RLIMIT_NOFILE, &value);
+            return static_cast<size_t>(value.rlim_cur);
+        }
+#endif
+        return size_t{ 1'024 };
+    }();
+
+    return std::min(connections, floored_subtract(limit, reserve) / two);
+}
+
+// Process cpu seconds (all threads).
+static double cpu_seconds()
+{
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+// Run the service to completion on the benchmark threads.
+static void run(boost::asio::io_context& service)
+{
+    std::vector<std::thread> workers{};
+    for (size_t thread{}; thread < threads; ++thread)
+        workers.emplace_back([&service]() { service.run(); });
+
+    for (auto& worker: workers)
+        worker.join();
+
+    service.restart();
+}
+
+struct connection
+{
+    explicit connection(boost::asio::io_context& service)
+      : server{ service }, client{ service }
+    {
+    }
+
+    tcp_socket server;
+    tcp_socket client;
+    data_chunk request{};
+    data_chunk echo{};
+    data_chunk response{};
+    std::vector<double> latencies{};
+    steady_clock::time_point sent{};
+};
+
+using connections_t = std::vector<std::unique_ptr<connection>>;
+
+// Establish the connections concurrently, returning seconds elapsed.
+// Accepted sockets are not paired with their clients, which is immaterial.
+static double connect_all(boost::asio::io_context& service,
+    tcp_acceptor& acceptor, connections_t& pairs,
+    std::atomic<size_t>& failures)
+{
+    const auto endpoint = acceptor.local_endpoint();
+    std::function<void(size_t)> accept{};
+    accept = [&](size_t index)
+    {
+        if (index == pairs.size())
+            return;
+
+        acceptor.async_accept(pairs.at(index)->server,
+            [&, index](const boost_code& ec)
+            {
+                if (ec) ++failures;
+                accept(add1(index));
+            });
+    };
+
+    const auto start = steady_clock::now();
+    accept(zero);
+    for (auto& pair: pairs)
+        pair->client.async_connect(endpoint, [&](const boost_code& ec)
+        {
+            if (ec) ++failures;
+        });
+
+    run(service);
+    return seconds_t{ steady_clock::now() - start }.count();
+}
+
+static connections_t make_connections(boost::asio::io_context& service,
+    size_t count)
+{
+    connections_t pairs{};
+    pairs.reserve(count);
+    for (size_t index{}; index < count; ++index)
+        pairs.push_back(std::make_unique<connection>(service));
+
+    return pairs;
+}
+
+// Accept: concurrent loopback connect/accept rate.
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(net_benchmark__accept__loopback)
+{
+    for (const auto scale: scales)
+    {
+        const auto count = capped(scale);
+        boost::asio::io_context service{};
+        tcp_acceptor acceptor{ service,
+            { boost::asio::ip::address_v4::loopback(), 0 } };
+        acceptor.listen(static_cast<int>(count));
+
+        std::atomic<size_t> failures{};
+        auto pairs = make_connections(service, count);
+        const auto cpu = cpu_seconds();
+        const auto elapsed = connect_all(service, acceptor, pairs, failures);
+        const auto used = cpu_seconds() - cpu;
+        BOOST_REQUIRE(is_zero(failures.load()));
+
+        report("accept_rate", count, zero, count / elapsed, "connections/s");
+        report("accept_cpu", count, zero, 1e6 * used / count, "us/connection");
+    }
+}
+
+// Echo: concurrent loopback round trip latency (tail) by message size.
+// ----------------------------------------------------------------------------
+
+static double percentile(const std::vector<double>& sorted, double fraction)
+{
+    if (sorted.empty())
+        return {};
+
+    const auto last = sub1(sorted.size());
+    return sorted.at(static_cast<size_t>(fraction * last));
+}
+
+static void echo_latency(size_t count, size_t size)
+{
+    boost::asio::io_context service{};
+    tcp_acceptor acceptor{ service,
+        { boost::asio::ip::address_v4::loopback(), 0 } };
+    acceptor.listen(static_cast<int>(count));
+
+    std::atomic<size_t> failures{};
+    auto pairs = make_connections(service, count);
+    connect_all(service, acceptor, pairs, failures);
+    BOOST_REQUIRE(is_zero(failures.load()));
+
+    for (auto& pair: pairs)
+    {
+        pair->server.set_option(boost::asio::ip::tcp::no_delay{ true });
+        pair->client.set_option(boost::asio::ip::tcp::no_delay{ true });
+        pair->request.assign(size, 0x42);
+        pair->echo.resize(size);
+        pair->response.resize(size);
+        pair->latencies.reserve(round_trips);
+    }
+
+    // Each server echoes round_trips messages of its (any) client.
+    std::function<void(connection&, size_t)> echo{};
+    echo = [&](connection& pair, size_t remaining)
+    {
+        if (is_zero(remaining))
+            return;
+
+        boost::asio::async_read(pair.server, boost::asio::buffer(pair.echo),
+            [&, remaining](const boost_code& ec, size_t)
+            {
+                if (ec) { ++failures; return; }
+                boost::asio::async_write(pair.server,
+                    boost::asio::buffer(pair.echo),
+                    [&, remaining](const boost_code& error, size_t)
+                    {
+                        if (error) { ++failures; return; }
+                        echo(pair, sub1(remaining));
+                    });
+            });
+    };
+
+    // Each client times each round trip.
+    std::function<void(connection&, size_t)> send{};
+    send = [&](connection& pair, size_t remaining)
+    {
+        if (is_zero(remaining))
+            return;
+
+        pair.sent = steady_clock::now();
+        boost::asio::async_write(pair.client,
+            boost::asio::buffer(pair.request),
+            [&](const boost_code& ec, size_t)
+            {
+                if (ec) ++failures;
+            });
+        boost::asio::async_read(pair.client,
+            boost::asio::buffer(pair.response),
+            [&, remaining](const boost_code& ec, size_t)
+            {
+                if (ec) { ++failures; return; }
+                pair.latencies.push_back(microseconds_t{
+                    steady_clock::now() - pair.sent }.count());
+                send(pair, sub1(remaining));
+            });
+    };
+
+    for (auto& pair: pairs)
+    {
+        echo(*pair, round_trips);
+        send(*pair, round_trips);
+    }
+
+    const auto cpu = cpu_seconds();
+    const auto start = steady_clock::now();
+    run(service);
+    const seconds_t elapsed{ steady_clock::now() - start };
+    const auto used = cpu_seconds() - cpu;
+    BOOST_REQUIRE(is_zero(failures.load()));
+
+    std::vector<double> latencies{};
+    latencies.reserve(count * round_trips);
+    for (const auto& pair: pairs)
+        latencies.insert(latencies.end(), pair->latencies.begin(),
+            pair->latencies.end());
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto bytes = static_cast<double>(two * size * latencies.size());
+    report("echo_p50", count, size, percentile(latencies, 0.5), "us");
+    report("echo_p99", count, size, percentile(latencies, 0.99), "us");
+    report("echo_p999", count, size, percentile(latencies, 0.999), "us");
+    report("echo_max", count, size, percentile(latencies, 1.0), "us");
+    report("echo_rate", count, size, latencies.size() / elapsed.count(),
+        "round_trips/s");
+    report("echo_cpu", count, size, 1e9 * used / bytes, "ns/byte");
+}
+
+BOOST_AUTO_TEST_CASE(net_benchmark__echo__loopback)
+{
+    const std::vector<size_t> sizes{ 24, 61, 1'024, 65'536 };
+    for (const auto scale: scales)
+        for (const auto size: sizes)
+            echo_latency(capped(scale), size);
+}
+
+// Stream: concurrent loopback one-way throughput by write size.
+// ----------------------------------------------------------------------------
+
+static void stream_throughput(size_t count, size_t size)
+{
+    boost::asio::io_context service{};
+    tcp_acceptor acceptor{ service,
+        { boost::asio::ip::address_v4::loopback(), 0 } };
+    acceptor.listen(static_cast<int>(count));
+
+    std::atomic<size_t> failures{};
+    auto pairs = make_connections(service, count);
+    connect_all(service, acceptor, pairs, failures);
+    BOOST_REQUIRE(is_zero(failures.load()));
+
+    // The volume is divided among the connections.
+    const auto writes = std::max(volume / (size * count), one);
+    for (auto& pair: pairs)
+    {
+        pair->request.assign(size, 0x42);
+        pair->response.resize(size);
+    }
+
+    std::function<void(connection&, size_t)> write{};
+    write = [&](connection& pair, size_t remaining)
+    {
+        if (is_zero(remaining))
+            return;
+
+        boost::asio::async_write(pair.client,
+            boost::asio::buffer(pair.request),
+            [&, remaining](const boost_code& ec, size_t)
+            {
+                if (ec) { ++failures; return; }
+                write(pair, sub1(remaining));
+            });
+    };
+
+    std::function<void(connection&, size_t)> read{};
+    read = [&](connection& pair, size_t remaining)
+    {
+        if (is_zero(remaining))
+            return;
+
+        boost::asio::async_read(pair.server,
+            boost::asio::buffer(pair.response),
+            [&, remaining](const boost_code& ec, size_t)
+            {
+                if (ec) { ++failures; return; }
+                read(pair, sub1(remaining));
+            });
+    };
+
+    for (auto& pair: pairs)
+    {
+        read(*pair, writes);
+        write(*pair, writes);
+    }
+
+    const auto cpu = cpu_seconds();
+    const auto start = steady_clock::now();
+    run(service);
+    const seconds_t elapsed{ steady_clock::now() - start };
+    const auto used = cpu_seconds() - cpu;
+    BOOST_REQUIRE(is_zero(failures.load()));
+
+    const auto bytes = static_cast<double>(count * writes * size);
+    report("stream_bytes", count, size, bytes / megabyte / elapsed.count(),
+        "MiB/s");
+    report("stream_cpu", count, size, 1e9 * used / bytes, "ns/byte");
+}
+
+BOOST_AUTO_TEST_CASE(net_benchmark__stream__loopback)
+{
+    const std::vector<size_t> sizes{ 1'024, 65'536, megabyte };
+    for (const auto scale: scales)
+        for (const auto size: sizes)
+            stream_throughput(capped(scale), size);
+}
+
+#endif // HAVE_SLOW_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
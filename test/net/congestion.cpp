@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(congestion_tests)
+
+BOOST_AUTO_TEST_CASE(congestion__construct__zero_high_water__one)
+{
+    const congestion instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.high_water(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(congestion__construct__default__empty_uncongested)
+{
+    const congestion instance{ 100 };
+    BOOST_REQUIRE_EQUAL(instance.queued(), 0u);
+    BOOST_REQUIRE(!instance.congested());
+}
+
+BOOST_AUTO_TEST_CASE(congestion__add__below_high_water__uncongested)
+{
+    congestion instance{ 100 };
+    instance.add(99);
+    BOOST_REQUIRE_EQUAL(instance.queued(), 99u);
+    BOOST_REQUIRE(!instance.congested());
+    BOOST_REQUIRE(instance.congested(1));
+}
+
+BOOST_AUTO_TEST_CASE(congestion__add__high_water__congested)
+{
+    congestion instance{ 100 };
+    instance.add(60);
+    instance.add(40);
+    BOOST_REQUIRE_EQUAL(instance.queued(), 100u);
+    BOOST_REQUIRE(instance.congested());
+}
+
+BOOST_AUTO_TEST_CASE(congestion__overflowed__default_maximum__false)
+{
+    congestion instance{ 100 };
+    instance.add(1000);
+    BOOST_REQUIRE_EQUAL(instance.maximum(), 0u);
+    BOOST_REQUIRE(!instance.overflowed(1000));
+    instance.remove(1000);
+}
+
+BOOST_AUTO_TEST_CASE(congestion__overflowed__beyond_maximum__true)
+{
+    congestion instance{ 100, 200 };
+    instance.add(150);
+    BOOST_REQUIRE_EQUAL(instance.maximum(), 200u);
+    BOOST_REQUIRE(instance.congested());
+    BOOST_REQUIRE(!instance.overflowed(50));
+    BOOST_REQUIRE(instance.overflowed(51));
+}
+
+BOOST_AUTO_TEST_CASE(congestion__remove__added__uncongested)
+{
+    congestion instance{ 100 };
+    instance.add(150);
+    instance.remove(100);
+    BOOST_REQUIRE_EQUAL(instance.queued(), 50u);
+    BOOST_REQUIRE(!instance.congested());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
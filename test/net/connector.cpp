@@ -16,6 +16,7 @@
  * You should have received a copy of the GNU Affero General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <fstream>
 #include "../test.hpp"
 
 BOOST_AUTO_TEST_SUITE(connector_tests)
@@ -25,6 +26,12 @@ class accessor
 {
 public:
     using connector::connector;
+    using connector::interleave;
+
+    attempts::ptr get_attempts() const NOEXCEPT
+    {
+        return attempts_;
+    }
 
     const asio::context& get_service() const NOEXCEPT
     {
@@ -295,4 +302,434 @@ BOOST_AUTO_TEST_CASE(connector__connect__started_start__operation_failed)
     BOOST_REQUIRE(result);
 }
 
+// Staggered connect.
+// ----------------------------------------------------------------------------
+
+using tcp = boost::asio::ip::tcp;
+constexpr auto multihomed = "multihomed.test";
+
+static asio::endpoint to_point(const std::string& host, uint16_t port)
+{
+    return { boost::asio::ip::make_address(host), port };
+}
+
+static asio::endpoints to_range(const std::vector<asio::endpoint>& points)
+{
+    return asio::endpoints::create(points.begin(), points.end(), multihomed,
+        "42");
+}
+
+// Cache the range as the resolution of multihomed:42.
+static resolver_cache::ptr to_cache(const std::vector<asio::endpoint>& points)
+{
+    const auto cache = std::make_shared<resolver_cache>(minutes(1));
+    cache->store(multihomed, 42, to_range(points));
+    return cache;
+}
+
+// Bound and not listening, connection is refused.
+static void bind_refusing(tcp::acceptor& acceptor)
+{
+    acceptor.open(tcp::v4());
+    acceptor.bind(to_point("127.0.0.1", 0));
+}
+
+// Listening and not accepting, the kernel completes the connection.
+static void bind_listening(tcp::acceptor& acceptor)
+{
+    bind_refusing(acceptor);
+    acceptor.listen();
+}
+
+// Listening with a full accept queue, connection is not answered (linux).
+static void bind_unanswered(tcp::acceptor& acceptor, tcp::socket& filler)
+{
+    bind_refusing(acceptor);
+    acceptor.listen(0);
+    filler.connect(acceptor.local_endpoint());
+}
+
+BOOST_AUTO_TEST_CASE(connector__interleave__single_family__unchanged)
+{
+    const std::vector<asio::endpoint> points
+    {
+        to_point("1.1.1.1", 1),
+        to_point("2.2.2.2", 2),
+        to_point("3.3.3.3", 3)
+    };
+
+    BOOST_REQUIRE(accessor::interleave(to_range(points)) == points);
+}
+
+BOOST_AUTO_TEST_CASE(connector__interleave__mixed_families__alternated_first_family_first)
+{
+    const std::vector<asio::endpoint> points
+    {
+        to_point("::1", 1),
+        to_point("::2", 2),
+        to_point("1.1.1.1", 3),
+        to_point("2.2.2.2", 4),
+        to_point("3.3.3.3", 5)
+    };
+
+    const std::vector<asio::endpoint> expected
+    {
+        to_point("::1", 1),
+        to_point("1.1.1.1", 3),
+        to_point("::2", 2),
+        to_point("2.2.2.2", 4),
+        to_point("3.3.3.3", 5)
+    };
+
+    BOOST_REQUIRE(accessor::interleave(to_range(points)) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__all_attempts_refused__one_failure_without_stagger)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+
+    boost::asio::io_context service{};
+    tcp::acceptor first{ service };
+    tcp::acceptor second{ service };
+    bind_refusing(first);
+    bind_refusing(second);
+    const auto cache = to_cache({ first.local_endpoint(), second.local_endpoint() });
+
+    // Long stagger, so the second attempt is started only by the first failure.
+    connector::parameters params{ .connect_timeout = seconds(100), .connect_stagger = seconds(100), .maximum_request = 42 };
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params), cache);
+    size_t calls{};
+    code result{};
+    socket::ptr channel{};
+    const auto start = steady_clock::now();
+    steady_clock::duration elapsed{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ multihomed, 42 },
+            [&](const code& ec, const socket::ptr& socket) NOEXCEPT
+            {
+                ++calls;
+                result = ec;
+                channel = socket;
+                elapsed = steady_clock::now() - start;
+            });
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance->get_stopped());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE(result);
+    BOOST_REQUIRE(result != error::operation_timeout);
+    BOOST_REQUIRE(!channel);
+    BOOST_REQUIRE(elapsed < seconds(100));
+    BOOST_REQUIRE_EQUAL(instance->get_attempts()->started, 2u);
+    BOOST_REQUIRE_EQUAL(instance->get_attempts()->failed, 2u);
+}
+
+#if defined(HAVE_LINUX)
+
+BOOST_AUTO_TEST_CASE(connector__connect__unanswered_then_listening__second_wins_after_stagger)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+
+    boost::asio::io_context service{};
+    tcp::acceptor unanswered{ service };
+    tcp::socket filler{ service };
+    tcp::acceptor listening{ service };
+    bind_unanswered(unanswered, filler);
+    bind_listening(listening);
+    const auto cache = to_cache({ unanswered.local_endpoint(), listening.local_endpoint() });
+
+    constexpr auto stagger = milliseconds(50);
+    connector::parameters params{ .connect_timeout = seconds(100), .connect_stagger = stagger, .maximum_request = 42 };
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params), cache);
+    size_t calls{};
+    code result{ error::unknown };
+    socket::ptr channel{};
+    const auto start = steady_clock::now();
+    steady_clock::duration elapsed{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ multihomed, 42 },
+            [&](const code& ec, const socket::ptr& socket) NOEXCEPT
+            {
+                ++calls;
+                result = ec;
+                channel = socket;
+                elapsed = steady_clock::now() - start;
+                if (socket) socket->stop();
+            });
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance->get_stopped());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE_EQUAL(result, error::success);
+    BOOST_REQUIRE(channel);
+
+    // The second attempt waited on the stagger (the first never completes).
+    BOOST_REQUIRE(elapsed >= stagger);
+
+    // The winner is the second attempt, and the losing primary is stopped.
+    const auto attempts = instance->get_attempts();
+    BOOST_REQUIRE(attempts->done);
+    BOOST_REQUIRE_EQUAL(attempts->sockets.size(), 2u);
+    BOOST_REQUIRE(channel == attempts->sockets.back());
+    BOOST_REQUIRE(attempts->sockets.front()->stopped());
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__listening_first__primary_wins_no_second_attempt)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+
+    boost::asio::io_context service{};
+    tcp::acceptor listening{ service };
+    tcp::acceptor unanswered{ service };
+    tcp::socket filler{ service };
+    bind_listening(listening);
+    bind_unanswered(unanswered, filler);
+    const auto cache = to_cache({ listening.local_endpoint(), unanswered.local_endpoint() });
+
+    connector::parameters params{ .connect_timeout = seconds(100), .connect_stagger = seconds(100), .maximum_request = 42 };
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params), cache);
+    code result{ error::unknown };
+    socket::ptr channel{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ multihomed, 42 },
+            [&](const code& ec, const socket::ptr& socket) NOEXCEPT
+            {
+                result = ec;
+                channel = socket;
+                if (socket) socket->stop();
+            });
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance->get_stopped());
+    BOOST_REQUIRE_EQUAL(result, error::success);
+
+    // The stagger was canceled by the win, so only the primary was attempted.
+    const auto attempts = instance->get_attempts();
+    BOOST_REQUIRE_EQUAL(attempts->started, 1u);
+    BOOST_REQUIRE(channel == attempts->sockets.front());
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__all_attempts_unanswered__one_timeout_all_stopped)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+
+    boost::asio::io_context service{};
+    tcp::acceptor first{ service };
+    tcp::acceptor second{ service };
+    tcp::socket filler1{ service };
+    tcp::socket filler2{ service };
+    bind_unanswered(first, filler1);
+    bind_unanswered(second, filler2);
+    const auto cache = to_cache({ first.local_endpoint(), second.local_endpoint() });
+
+    connector::parameters params{ .connect_timeout = milliseconds(200), .connect_stagger = milliseconds(10), .maximum_request = 42 };
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params), cache);
+    size_t calls{};
+    code result{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ multihomed, 42 },
+            [&](const code& ec, const socket::ptr&) NOEXCEPT
+            {
+                ++calls;
+                result = ec;
+            });
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance->get_stopped());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE_EQUAL(result, error::operation_timeout);
+
+    const auto attempts = instance->get_attempts();
+    BOOST_REQUIRE(attempts->expired);
+    BOOST_REQUIRE_EQUAL(attempts->sockets.size(), 2u);
+    for (const auto& socket: attempts->sockets)
+        BOOST_REQUIRE(socket->stopped());
+}
+
+// Fast open is not used for resolved hosts, so an unanswered one times out.
+static code fast_open_unanswered(size_t count)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+
+    boost::asio::io_context service{};
+    std::vector<std::unique_ptr<tcp::acceptor>> acceptors{};
+    std::vector<std::unique_ptr<tcp::socket>> fillers{};
+    std::vector<asio::endpoint> points{};
+    for (size_t index{}; index < count; ++index)
+    {
+        acceptors.push_back(std::make_unique<tcp::acceptor>(service));
+        fillers.push_back(std::make_unique<tcp::socket>(service));
+        bind_unanswered(*acceptors.back(), *fillers.back());
+        points.push_back(acceptors.back()->local_endpoint());
+    }
+
+    connector::parameters params
+    {
+        .connect_timeout = milliseconds(200),
+        .connect_stagger = milliseconds(10),
+        .maximum_request = 42,
+        .tuning = { .fast_open = true }
+    };
+
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params), to_cache(points));
+    size_t calls{};
+    code result{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ multihomed, 42 },
+            [&](const code& ec, const socket::ptr& socket) NOEXCEPT
+            {
+                ++calls;
+                result = ec;
+                if (socket) socket->stop();
+            });
+    });
+
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(instance->get_stopped());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__fast_open_unanswered_host__operation_timeout)
+{
+    BOOST_REQUIRE_EQUAL(fast_open_unanswered(1), error::operation_timeout);
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__fast_open_unanswered_raced_hosts__operation_timeout)
+{
+    BOOST_REQUIRE_EQUAL(fast_open_unanswered(2), error::operation_timeout);
+}
+
+#if defined(TCP_FASTOPEN_CONNECT)
+
+// Fast open requires client and server enablement (net.ipv4.tcp_fastopen).
+static bool fast_open_enabled()
+{
+    std::ifstream file{ "/proc/sys/net/ipv4/tcp_fastopen" };
+    uint32_t value{};
+    return (file >> value) && ((value & 3u) == 3u);
+}
+
+// Connect a numeric host with fast open and write one byte. True if the byte
+// was carried in the syn (using the cookie of a prior connect to the host).
+static bool fast_open_syn_data(tcp::acceptor& listener)
+{
+    logger log{};
+    log.stop();
+    threadpool pool(2);
+    std::atomic_bool suspended{ false };
+    asio::strand strand(pool.service().get_executor());
+    const auto port = listener.local_endpoint().port();
+    connector::parameters params
+    {
+        .connect_timeout = seconds(10),
+        .maximum_request = 42,
+        .tuning = { .fast_open = true }
+    };
+
+    auto instance = std::make_shared<accessor>(log, strand, pool.service(), suspended, std::move(params));
+    constexpr uint8_t byte{ 0x42 };
+    std::promise<code> written{};
+    socket::ptr channel{};
+
+    boost::asio::post(strand, [&, instance]() NOEXCEPT
+    {
+        instance->connect(config::endpoint{ "127.0.0.1", port },
+            [&](const code& ec, const socket::ptr& socket) NOEXCEPT
+            {
+                if (ec)
+                {
+                    written.set_value(ec);
+                    return;
+                }
+
+                channel = socket;
+                socket->tcp_write({ &byte, one },
+                    [&](const code& error, size_t) NOEXCEPT
+                    {
+                        written.set_value(error);
+                    });
+            });
+    });
+
+    auto server = listener.accept();
+    uint8_t received{};
+    boost::asio::read(server, boost::asio::buffer(&received, one));
+    BOOST_REQUIRE_EQUAL(written.get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(received, byte);
+
+    tcp_info info{};
+    socklen_t size{ sizeof(info) };
+    BOOST_REQUIRE(is_zero(::getsockopt(server.native_handle(), IPPROTO_TCP,
+        TCP_INFO, &info, &size)));
+
+    channel->stop();
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    return to_bool(info.tcpi_options & TCPI_OPT_SYN_DATA);
+}
+
+BOOST_AUTO_TEST_CASE(connector__connect__fast_open_reconnect__cookie_used)
+{
+    if (!fast_open_enabled())
+    {
+        BOOST_TEST_MESSAGE("Skipped, requires net.ipv4.tcp_fastopen=3.");
+        return;
+    }
+
+    boost::asio::io_context service{};
+    tcp::acceptor listener{ service };
+    bind_refusing(listener);
+    listener.set_option(asio::tcp_option<TCP_FASTOPEN>(16));
+    listener.listen();
+
+    // The first connect obtains the cookie (if not already cached for the
+    // host), and the reconnect carries its first write in the syn.
+    fast_open_syn_data(listener);
+    BOOST_REQUIRE(fast_open_syn_data(listener));
+}
+
+#endif // TCP_FASTOPEN_CONNECT
+
+#endif // HAVE_LINUX
+
 BOOST_AUTO_TEST_SUITE_END()
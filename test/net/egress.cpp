@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(egress_tests)
+
+BOOST_AUTO_TEST_CASE(egress__construct__zero_rate__one)
+{
+    const egress instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.rate(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(egress__charge__new_channel__full_share_not_deferred)
+{
+    egress instance{ 1000 };
+
+    // A new bucket holds one second of its share.
+    const auto first = instance.charge(42, 1, 1000);
+    BOOST_REQUIRE(first == steady_clock::duration{});
+
+    // And is then empty.
+    const auto second = instance.charge(42, 1, 500);
+    BOOST_REQUIRE(second > milliseconds(400));
+    BOOST_REQUIRE(second <= milliseconds(500));
+}
+
+BOOST_AUTO_TEST_CASE(egress__charge__two_channels_one_service__isolated)
+{
+    egress instance{ 1000 };
+
+    // Both active at equal weight, each channel has 500 bytes/second.
+    instance.charge(1, 1, 0);
+    instance.charge(2, 1, 0);
+
+    // The first channel overdraws its own (full) bucket by a second of its
+    // share.
+    const auto busy = instance.charge(1, 1, 1000);
+    BOOST_REQUIRE(busy > milliseconds(900));
+    BOOST_REQUIRE(busy <= seconds(1));
+
+    // The second channel of the same service is not charged that debt.
+    const auto idle = instance.charge(2, 1, 0);
+    BOOST_REQUIRE(idle == steady_clock::duration{});
+
+    // And again only bears its own (equal) share.
+    const auto other = instance.charge(2, 1, 750);
+    BOOST_REQUIRE(other > milliseconds(400));
+    BOOST_REQUIRE(other <= milliseconds(500));
+}
+
+BOOST_AUTO_TEST_CASE(egress__charge__debt__deferred_by_share)
+{
+    egress instance{ 1000 };
+
+    // 500 bytes beyond a full bucket at 1000 bytes/second is about half a
+    // second of debt.
+    const auto delay = instance.charge(42, 1, 1500);
+    BOOST_REQUIRE(delay > milliseconds(400));
+    BOOST_REQUIRE(delay <= milliseconds(500));
+}
+
+BOOST_AUTO_TEST_CASE(egress__charge__weighted_channels__deferred_by_weight)
+{
+    egress instance{ 1000 };
+
+    // Both active, heavy has 750 bytes/second and light has 250 bytes/second.
+    instance.charge(1, 3, 0);
+    const auto slow = instance.charge(2, 1, 500);
+    const auto fast = instance.charge(1, 3, 1000);
+    BOOST_REQUIRE(slow > milliseconds(900));
+    BOOST_REQUIRE(fast < milliseconds(400));
+    BOOST_REQUIRE(fast > milliseconds(250));
+}
+
+BOOST_AUTO_TEST_CASE(egress__charge__zero_weight__treated_as_one)
+{
+    egress instance{ 1000 };
+
+    const auto delay = instance.charge(42, 0, 1500);
+    BOOST_REQUIRE(delay > milliseconds(400));
+    BOOST_REQUIRE(delay <= milliseconds(500));
+}
+
+BOOST_AUTO_TEST_CASE(egress__release__released_channel__share_returned)
+{
+    egress instance{ 1000 };
+
+    // Two active channels, then one is released (stopped).
+    instance.charge(1, 1, 0);
+    instance.charge(2, 1, 0);
+    instance.release(2);
+
+    // The remaining channel has the full rate.
+    const auto delay = instance.charge(1, 1, 1500);
+    BOOST_REQUIRE(delay > milliseconds(400));
+    BOOST_REQUIRE(delay <= milliseconds(500));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(ingress_tests)
+
+BOOST_AUTO_TEST_CASE(ingress__construct__zero_rate__one)
+{
+    const ingress instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.rate(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ingress__construct__default__no_deferrals)
+{
+    const ingress instance{ 1000 };
+    BOOST_REQUIRE_EQUAL(instance.deferrals(), 0u);
+    BOOST_REQUIRE(instance.deferred() == steady_clock::duration{});
+}
+
+BOOST_AUTO_TEST_CASE(ingress__charge__zero_bytes__zero)
+{
+    ingress instance{ 1000 };
+    BOOST_REQUIRE(instance.charge(0) == steady_clock::duration{});
+    BOOST_REQUIRE_EQUAL(instance.deferrals(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ingress__charge__within_burst__zero)
+{
+    // The budget starts full, with one second of burst.
+    ingress instance{ 1000 };
+    BOOST_REQUIRE(instance.charge(1000) == steady_clock::duration{});
+    BOOST_REQUIRE_EQUAL(instance.deferrals(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ingress__charge__debt__deferred_and_counted)
+{
+    ingress instance{ 1000 };
+
+    // 500 bytes over the burst at 1000 bytes/second is about half a second.
+    const auto delay = instance.charge(1500);
+    BOOST_REQUIRE(delay > milliseconds(400));
+    BOOST_REQUIRE(delay <= milliseconds(500));
+    BOOST_REQUIRE_EQUAL(instance.deferrals(), 1u);
+    BOOST_REQUIRE(instance.deferred() == delay);
+}
+
+BOOST_AUTO_TEST_CASE(ingress__charge__accumulated_debt__accumulated_deferral)
+{
+    ingress instance{ 1000 };
+    const auto first = instance.charge(1250);
+    const auto second = instance.charge(250);
+    BOOST_REQUIRE(second > first);
+    BOOST_REQUIRE(second > milliseconds(400));
+    BOOST_REQUIRE_EQUAL(instance.deferrals(), 2u);
+    BOOST_REQUIRE(instance.deferred() == first + second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
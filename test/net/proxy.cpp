@@ -37,9 +37,24 @@ public:
         return proxy::unconsumed(bytes, start);
     }
 
+    // Call must be stranded.
+    bool deferred1(size_t bytes, result_handler handler) NOEXCEPT
+    {
+        return proxy::deferred(bytes, std::move(handler));
+    }
+
+    // Call must be stranded.
+    void write1(messages::peer::frame&& message,
+        messages::peer::priority level, size_t size,
+        count_handler&& handler) NOEXCEPT
+    {
+        proxy::write(std::move(message), level, size, std::move(handler));
+    }
+
     // Access protected constructor.
-    mock_proxy(const socket::ptr& socket, uint32_t rate_limit=0) NOEXCEPT
-      : proxy(socket, rate_limit)
+    mock_proxy(const socket::ptr& socket, uint32_t rate_limit=0,
+        uint32_t read_limit=0, size_t high_water=0, size_t maximum=0) NOEXCEPT
+      : proxy(socket, rate_limit, read_limit, high_water, maximum)
     {
     }
 };
@@ -114,6 +129,181 @@ BOOST_AUTO_TEST_CASE(proxy__unconsumed__stopped__zero)
     BOOST_REQUIRE_EQUAL(deferral.get_future().get(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(proxy__deferred__unlimited__false)
+{
+    const logger log{};
+    threadpool pool(1);
+    socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr);
+
+    std::promise<bool> deferred;
+    boost::asio::post(proxy_ptr->strand(), [=, &deferred]() NOEXCEPT
+    {
+        deferred.set_value(proxy_ptr->deferred1(1000, [](const code&) NOEXCEPT {}));
+    });
+
+    BOOST_REQUIRE(!deferred.get_future().get());
+    BOOST_REQUIRE_EQUAL(proxy_ptr->deferrals(), 0u);
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(proxy__deferred__within_burst__false)
+{
+    const logger log{};
+    threadpool pool(1);
+    socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr, 0, 10'000);
+
+    // The budget starts full, so first reads up to the burst are not held.
+    std::promise<bool> deferred;
+    boost::asio::post(proxy_ptr->strand(), [=, &deferred]() NOEXCEPT
+    {
+        deferred.set_value(proxy_ptr->deferred1(10'000, [](const code&) NOEXCEPT {}));
+    });
+
+    BOOST_REQUIRE(!deferred.get_future().get());
+    BOOST_REQUIRE_EQUAL(proxy_ptr->deferrals(), 0u);
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(proxy__deferred__overdrawn__deferred_and_counted)
+{
+    const logger log{};
+    threadpool pool(1);
+    socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr, 0, 10'000);
+
+    // 1000 bytes over the burst at 10000 bytes/second is about 100ms of debt.
+    std::promise<bool> deferred;
+    std::promise<code> repaid;
+    boost::asio::post(proxy_ptr->strand(), [=, &deferred, &repaid]() NOEXCEPT
+    {
+        deferred.set_value(proxy_ptr->deferred1(11'000,
+            [&repaid](const code& ec) NOEXCEPT
+            {
+                repaid.set_value(ec);
+            }));
+    });
+
+    BOOST_REQUIRE(deferred.get_future().get());
+    BOOST_REQUIRE_EQUAL(repaid.get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(proxy_ptr->deferrals(), 1u);
+    BOOST_REQUIRE(proxy_ptr->deferred() > milliseconds(50));
+    BOOST_REQUIRE(proxy_ptr->deferred() <= milliseconds(100));
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(proxy__queued__default__empty_uncongested)
+{
+    const logger log{};
+    threadpool pool(1);
+    socket::parameters params{ .maximum_request = 42 };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr, 0, 0, 100, 200);
+    BOOST_REQUIRE_EQUAL(proxy_ptr->queued(), 0u);
+    BOOST_REQUIRE_EQUAL(proxy_ptr->dropped(), 0u);
+    BOOST_REQUIRE(!proxy_ptr->congested());
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+}
+
+BOOST_AUTO_TEST_CASE(proxy__congested__network_high_water__true)
+{
+    const logger log{};
+    threadpool pool(1);
+    const auto backlog = std::make_shared<congestion>(100);
+    backlog->add(100);
+    socket::parameters params{ .maximum_request = 42, .congestion = backlog };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr);
+    BOOST_REQUIRE(proxy_ptr->congested());
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+    backlog->remove(100);
+}
+
+template <class Message>
+static messages::peer::frame to_frame(const Message& message) NOEXCEPT
+{
+    messages::peer::frame out{};
+    out.version = messages::peer::level::maximum_protocol;
+    out.message = rpc::any_t{ system::to_shared(message) };
+    out.index = rpc::peer_registry::index_of<Message>();
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(proxy__write__congested__announcement_dropped_response_queued)
+{
+    using namespace messages::peer;
+    const logger log{};
+    threadpool pool(1);
+    const auto backlog = std::make_shared<congestion>(100);
+    backlog->add(100);
+    socket::parameters params{ .maximum_request = 42, .congestion = backlog };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr);
+
+    code announced{ error::unknown };
+    code responded{ error::unknown };
+    std::promise<std::pair<uint64_t, uint64_t>> promise;
+    boost::asio::post(proxy_ptr->strand(), [&]() NOEXCEPT
+    {
+        // The announcement is dropped and reported to its sender.
+        proxy_ptr->write1(to_frame(inventory{}), priority::announce, 10,
+            [&](const code& ec, size_t) NOEXCEPT { announced = ec; });
+
+        // The response (getdata/notfound class) is queued despite congestion.
+        proxy_ptr->write1(to_frame(not_found{}), priority::bulk, 10,
+            [&](const code& ec, size_t) NOEXCEPT { responded = ec; });
+
+        promise.set_value({ proxy_ptr->dropped(), proxy_ptr->queued() });
+    });
+
+    const auto result = promise.get_future().get();
+    BOOST_REQUIRE_EQUAL(announced, error::write_dropped);
+    BOOST_REQUIRE_EQUAL(result.first, 1u);
+    BOOST_REQUIRE_EQUAL(result.second, 10u);
+    proxy_ptr->stop(error::invalid_magic);
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    BOOST_REQUIRE(responded != error::write_dropped);
+}
+
+BOOST_AUTO_TEST_CASE(proxy__write__network_maximum__response_overflow_stopped)
+{
+    using namespace messages::peer;
+    const logger log{};
+    threadpool pool(1);
+    const auto backlog = std::make_shared<congestion>(100, 200);
+    backlog->add(195);
+    socket::parameters params{ .maximum_request = 42, .congestion = backlog };
+    auto socket_ptr = std::make_shared<network::socket>(log, pool.service(), std::move(params));
+    auto proxy_ptr = std::make_shared<mock_proxy>(socket_ptr);
+
+    std::promise<uint64_t> promise;
+    boost::asio::post(proxy_ptr->strand(), [&]() NOEXCEPT
+    {
+        // A response that would exceed the network maximum stops the channel.
+        proxy_ptr->write1(to_frame(not_found{}), priority::bulk, 10,
+            [](const code&, size_t) NOEXCEPT {});
+
+        promise.set_value(proxy_ptr->queued());
+    });
+
+    BOOST_REQUIRE_EQUAL(promise.get_future().get(), 0u);
+    BOOST_REQUIRE(proxy_ptr->stopped());
+    BOOST_REQUIRE_EQUAL(backlog->queued(), 195u);
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    backlog->remove(195);
+}
+
 BOOST_AUTO_TEST_CASE(proxy__paused__default__true)
 {
     const logger log{};
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(resolver_cache_tests)
+
+static asio::endpoints to_range(const std::string& host, uint16_t port)
+{
+    return asio::endpoints::create({ boost::asio::ip::make_address(host), port },
+        host, std::to_string(port));
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__to_endpoint__ipv4__true_expected)
+{
+    asio::endpoint point{};
+    BOOST_REQUIRE(resolver_cache::to_endpoint(point, "42.42.42.42", 8333));
+    BOOST_REQUIRE(point.address().is_v4());
+    BOOST_REQUIRE_EQUAL(point.address().to_string(), "42.42.42.42");
+    BOOST_REQUIRE_EQUAL(point.port(), 8333u);
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__to_endpoint__ipv6__true_expected)
+{
+    asio::endpoint point{};
+    BOOST_REQUIRE(resolver_cache::to_endpoint(point, "::1", 42));
+    BOOST_REQUIRE(point.address().is_v6());
+    BOOST_REQUIRE(point.address().is_loopback());
+    BOOST_REQUIRE_EQUAL(point.port(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__to_endpoint__bracketed_ipv6__true_expected)
+{
+    asio::endpoint point{};
+    BOOST_REQUIRE(resolver_cache::to_endpoint(point, "[::1]", 42));
+    BOOST_REQUIRE(point.address().is_v6());
+    BOOST_REQUIRE(point.address().is_loopback());
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__to_endpoint__hostname__false)
+{
+    asio::endpoint point{};
+    BOOST_REQUIRE(!resolver_cache::to_endpoint(point, "localhost", 42));
+    BOOST_REQUIRE(!resolver_cache::to_endpoint(point, "mainnet1.libbitcoin.net", 42));
+    BOOST_REQUIRE(!resolver_cache::to_endpoint(point, "", 42));
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__find__empty__false)
+{
+    resolver_cache instance{ seconds(42) };
+    asio::endpoints range{};
+    BOOST_REQUIRE(!instance.find(range, "localhost", 42));
+    BOOST_REQUIRE(range.empty());
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__store__find__same_host_port__true_expected)
+{
+    resolver_cache instance{ seconds(42) };
+    instance.store("localhost", 42, to_range("127.0.0.1", 42));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    asio::endpoints range{};
+    BOOST_REQUIRE(instance.find(range, "localhost", 42));
+    BOOST_REQUIRE_EQUAL(range.size(), 1u);
+    BOOST_REQUIRE_EQUAL(range.begin()->endpoint().address().to_string(), "127.0.0.1");
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__store__find__different_port__false)
+{
+    resolver_cache instance{ seconds(42) };
+    instance.store("localhost", 42, to_range("127.0.0.1", 42));
+
+    asio::endpoints range{};
+    BOOST_REQUIRE(!instance.find(range, "localhost", 24));
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__store__zero_lifetime__not_stored)
+{
+    resolver_cache instance{ seconds(0) };
+    instance.store("localhost", 42, to_range("127.0.0.1", 42));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__store__empty_range__not_stored)
+{
+    resolver_cache instance{ seconds(42) };
+    instance.store("localhost", 42, {});
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__find__expired__false_removed)
+{
+    resolver_cache instance{ nanoseconds(1) };
+    instance.store("localhost", 42, to_range("127.0.0.1", 42));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    std::this_thread::sleep_for(milliseconds(1));
+
+    asio::endpoints range{};
+    BOOST_REQUIRE(!instance.find(range, "localhost", 42));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(resolver_cache__store__at_capacity__bounded)
+{
+    resolver_cache instance{ seconds(42), 2 };
+    instance.store("a", 42, to_range("127.0.0.1", 42));
+    instance.store("b", 42, to_range("127.0.0.1", 42));
+    instance.store("c", 42, to_range("127.0.0.1", 42));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    asio::endpoints range{};
+    BOOST_REQUIRE(instance.find(range, "c", 42));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
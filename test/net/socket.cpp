@@ -18,7 +18,9 @@
  */
 #include "../test.hpp"
 
+#include <functional>
 #include <future>
+#include <thread>
 
 BOOST_AUTO_TEST_SUITE(socket_tests)
 
@@ -343,4 +345,192 @@ BOOST_AUTO_TEST_CASE(socket__body_write__websocket_multiple_chunks__single_messa
     BOOST_REQUIRE(pool.join());
 }
 
+// Peer read (read_ahead).
+// ----------------------------------------------------------------------------
+// A real (blocking) loopback client writes v1 frames, in the given writes (a
+// pause between each), which the accepted socket reads as count messages.
+
+using system::data_chunk;
+
+constexpr uint32_t peer_magic = 0xd9b4bef9;
+constexpr auto peer_version = messages::peer::level::bip31;
+
+struct peer_reads
+{
+    code ec{ error::success };
+    std::vector<std::string> commands{};
+    std::vector<uint64_t> nonces{};
+};
+
+static data_chunk ping_frame(uint64_t nonce)
+{
+    const auto data = messages::peer::serialize(messages::peer::ping{ nonce },
+        peer_magic, peer_version);
+    BOOST_REQUIRE(data);
+    return *data;
+}
+
+static data_chunk inventory_frame(size_t count)
+{
+    using namespace messages::peer;
+    const auto data = serialize(inventory::factory(system::hashes(count),
+        inventory_item::type_id::witness_tx), peer_magic, peer_version);
+    BOOST_REQUIRE(data);
+    return *data;
+}
+
+static peer_reads read_peer(size_t read_ahead,
+    const std::vector<data_chunk>& writes, size_t count)
+{
+    using namespace std::chrono_literals;
+    using namespace messages::peer;
+
+    const logger log{};
+    threadpool pool(2);
+    socket::parameters params{ .maximum_request = 1'000'000u,
+        .read_ahead = read_ahead };
+
+    asio::strand accept_strand(pool.service().get_executor());
+    asio::acceptor acceptor(accept_strand);
+    boost_code ec{};
+    const asio::endpoint bind_endpoint(asio::ipv4::loopback(), 0);
+    acceptor.open(bind_endpoint.protocol(), ec);
+    BOOST_REQUIRE(!ec);
+    acceptor.bind(bind_endpoint, ec);
+    BOOST_REQUIRE(!ec);
+    acceptor.listen(1, ec);
+    BOOST_REQUIRE(!ec);
+    const auto port = acceptor.local_endpoint().port();
+
+    struct state
+    {
+        frame message{};
+        data_chunk buffer{};
+        peer_reads result{};
+        std::promise<peer_reads> promise{};
+        std::function<void()> read{};
+    };
+
+    const auto server = std::make_shared<socket_accessor>(log, pool.service(), std::move(params));
+    const auto shared = std::make_shared<state>();
+    auto future = shared->promise.get_future();
+
+    // Each message is read upon completion of the last (as by a channel).
+    shared->read = [server, shared, count]() NOEXCEPT
+    {
+        shared->message = frame
+        {
+            .magic = peer_magic,
+            .version = peer_version,
+            .witness = true,
+            .checksum = true,
+            .maximum = heading::maximum_payload(peer_version, true)
+        };
+
+        server->peer_read(shared->buffer, shared->message,
+            [shared, count](const code& read_ec, size_t) NOEXCEPT
+            {
+                auto& result = shared->result;
+                if (!read_ec)
+                {
+                    result.commands.push_back(shared->message.head.command);
+                    if (const auto ping = shared->message.payload.get<
+                        const messages::peer::ping>())
+                        result.nonces.push_back(ping->nonce);
+                }
+
+                if (read_ec || result.commands.size() == count)
+                {
+                    result.ec = read_ec;
+                    shared->promise.set_value(result);
+                    shared->read = {};
+                    return;
+                }
+
+                shared->read();
+            });
+    };
+
+    server->accept(acceptor, [shared](const code& accept_ec) NOEXCEPT
+    {
+        if (!accept_ec)
+        {
+            shared->read();
+            return;
+        }
+
+        shared->result.ec = accept_ec;
+        shared->promise.set_value(shared->result);
+        shared->read = {};
+    });
+
+    asio::context client_service;
+    asio::socket client(client_service);
+    boost_code client_ec{};
+    client.connect({ asio::ipv4::loopback(), port }, client_ec);
+    BOOST_REQUIRE(!client_ec);
+
+    // Each write is expected to arrive as its own fill (pause between).
+    for (const auto& write: writes)
+    {
+        boost::asio::write(client, boost::asio::buffer(write), client_ec);
+        BOOST_REQUIRE(!client_ec);
+        std::this_thread::sleep_for(50ms);
+    }
+
+    BOOST_REQUIRE(future.wait_for(5s) == std::future_status::ready);
+    const auto result = future.get();
+
+    client.close(client_ec);
+    server->stop();
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(socket__peer_read__read_ahead_heading_split_across_fills__expected)
+{
+    // The heading (24 bytes) arrives in two fills of the read-ahead buffer.
+    const auto ping = ping_frame(42);
+    const data_chunk first{ ping.begin(), std::next(ping.begin(), 10) };
+    const data_chunk second{ std::next(ping.begin(), 10), ping.end() };
+
+    const auto result = read_peer(64, { first, second }, 1);
+    BOOST_REQUIRE_EQUAL(result.ec, error::success);
+    BOOST_REQUIRE_EQUAL(result.commands.size(), 1u);
+    BOOST_REQUIRE_EQUAL(result.commands.front(), messages::peer::ping::command);
+    BOOST_REQUIRE(result.nonces == std::vector<uint64_t>{ 42 });
+}
+
+BOOST_AUTO_TEST_CASE(socket__peer_read__read_ahead_several_messages_one_fill__expected)
+{
+    // Three frames (32 bytes each) arrive in one fill of the read-ahead.
+    data_chunk frames{};
+    for (const uint64_t nonce: { 1, 2, 3 })
+    {
+        const auto ping = ping_frame(nonce);
+        frames.insert(frames.end(), ping.begin(), ping.end());
+    }
+
+    const auto result = read_peer(128, { frames }, 3);
+    BOOST_REQUIRE_EQUAL(result.ec, error::success);
+    BOOST_REQUIRE_EQUAL(result.commands.size(), 3u);
+    BOOST_REQUIRE(result.nonces == (std::vector<uint64_t>{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(socket__peer_read__payload_larger_than_read_ahead__expected)
+{
+    // The inventory payload (361 bytes) exceeds the read-ahead (64 bytes), so
+    // it is drained of buffered bytes and the remainder is read directly.
+    data_chunk frames{};
+    for (const auto& framed: { ping_frame(1), inventory_frame(10), ping_frame(2) })
+        frames.insert(frames.end(), framed.begin(), framed.end());
+
+    const auto result = read_peer(64, { frames }, 3);
+    BOOST_REQUIRE_EQUAL(result.ec, error::success);
+    BOOST_REQUIRE_EQUAL(result.commands.size(), 3u);
+    BOOST_REQUIRE_EQUAL(result.commands.at(1), messages::peer::inventory::command);
+    BOOST_REQUIRE(result.nonces == (std::vector<uint64_t>{ 1, 2 }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,409 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <optional>
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(privacy_benchmark_tests)
+
+#if defined(HAVE_SLOW_TESTS)
+
+using namespace network::privacy;
+using namespace network::messages::peer;
+using tcp_socket = network::asio::socket;
+using seconds_t = std::chrono::duration<double>;
+using system::data_chunk;
+
+constexpr uint32_t mainnet = 0xd9b4bef9;
+constexpr size_t handshakes = 200;
+constexpr size_t megabyte = 1024u * 1024u;
+constexpr size_t volume = 64u * megabyte;
+
+// Each result is one json object per line (for regression tracking).
+static void report(const std::string& benchmark, size_t parameter,
+    double value, const std::string& unit)
+{
+    std::cout << R"({"suite":"privacy","benchmark":")" << benchmark
+        << R"(","parameter":)" << parameter << R"(,"value":)" << value
+        << R"(,"unit":")" << unit << R"("})" << std::endl;
+}
+
+// Bound the number of iterations to a fixed volume of bytes.
+static size_t iterations(size_t bytes, size_t minimum, size_t maximum)
+{
+    return std::clamp(volume / std::max(bytes, one), minimum, maximum);
+}
+
+// Establish a connected local socket pair on the given service.
+static void connect_pair(boost::asio::io_context& service,
+    boost::asio::ip::tcp::acceptor& acceptor, tcp_socket& server,
+    tcp_socket& client)
+{
+    acceptor.async_accept(server, [](const boost_code& ec)
+    {
+        BOOST_REQUIRE(!ec);
+    });
+    client.async_connect(acceptor.local_endpoint(), [](const boost_code& ec)
+    {
+        BOOST_REQUIRE(!ec);
+    });
+
+    service.run();
+    service.restart();
+}
+
+// Handshake: stream initiator and stream responder (no garbage).
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(privacy_benchmark__handshake__loopback)
+{
+    boost::asio::io_context service{};
+    boost::asio::ip::tcp::acceptor acceptor{ service,
+        { boost::asio::ip::address_v4::loopback(), 0 } };
+
+    const context configuration{ mainnet };
+    seconds_t initiating{};
+    seconds_t responding{};
+
+    const auto start = steady_clock::now();
+    for (size_t count{}; count < handshakes; ++count)
+    {
+        tcp_socket server{ service };
+        tcp_socket client{ service };
+        connect_pair(service, acceptor, server, client);
+
+        // The responder is constructed following detection, as by socket.
+        stream initiator{ std::move(client), configuration };
+        std::optional<stream> responder{};
+        data_chunk prefix(stream::detection_size);
+        boost_code initiated{};
+        boost_code responded{};
+
+        const auto begin = steady_clock::now();
+        initiator.async_handshake([&](const boost_code& ec)
+        {
+            initiated = ec;
+            initiating += steady_clock::now() - begin;
+        });
+        boost::asio::async_read(server,
+            boost::asio::mutable_buffer{ prefix.data(), prefix.size() },
+            [&](const boost_code&, size_t)
+            {
+                responder.emplace(std::move(server), configuration);
+                responder->async_handshake(std::move(prefix),
+                    [&](const boost_code& ec)
+                    {
+                        responded = ec;
+                        responding += steady_clock::now() - begin;
+                    });
+            });
+
+        service.run();
+        service.restart();
+        BOOST_REQUIRE(!initiated && !responded);
+    }
+
+    const seconds_t elapsed{ steady_clock::now() - start };
+    report("handshake_initiator_latency", zero,
+        1e6 * initiating.count() / handshakes, "us");
+    report("handshake_responder_latency", zero,
+        1e6 * responding.count() / handshakes, "us");
+    report("handshake_rate", zero, handshakes / elapsed.count(),
+        "handshakes/s");
+}
+
+// Handshake: raw initiator sending garbage, stream responder (scanning).
+// ----------------------------------------------------------------------------
+
+static void handshake_garbage(size_t size)
+{
+    boost::asio::io_context service{};
+    boost::asio::ip::tcp::acceptor acceptor{ service,
+        { boost::asio::ip::address_v4::loopback(), 0 } };
+
+    const context configuration{ mainnet };
+    const data_chunk garbage(size, 0x5a);
+    seconds_t responding{};
+
+    const auto start = steady_clock::now();
+    for (size_t count{}; count < handshakes; ++count)
+    {
+        tcp_socket server{ service };
+        tcp_socket client{ service };
+        connect_pair(service, acceptor, server, client);
+
+        // The initiator sends its key and garbage, then (once keyed) its
+        // terminator and version packet (garbage is the first packet aad).
+        cipher initiator{};
+        data_chunk opening{ initiator.public_key().begin(),
+            initiator.public_key().end() };
+        opening.insert(opening.end(), garbage.begin(), garbage.end());
+
+        cipher::key theirs{};
+        data_chunk closing{};
+        boost::asio::async_write(client,
+            boost::asio::const_buffer{ opening.data(), opening.size() },
+            [](const boost_code& ec, size_t) { BOOST_REQUIRE(!ec); });
+        boost::asio::async_read(client,
+            boost::asio::mutable_buffer{ theirs.data(), theirs.size() },
+            [&](const boost_code& ec, size_t)
+            {
+                BOOST_REQUIRE(!ec);
+                BOOST_REQUIRE(initiator.initialize(theirs, mainnet, true));
+                const auto& terminator = initiator.send_terminator();
+                closing.assign(terminator.begin(), terminator.end());
+                data_chunk packet(cipher::expansion);
+                initiator.encrypt({}, garbage, false, packet);
+                closing.insert(closing.end(), packet.begin(), packet.end());
+                boost::asio::async_write(client, boost::asio::const_buffer
+                    { closing.data(), closing.size() },
+                    [](const boost_code& ec, size_t) { BOOST_REQUIRE(!ec); });
+            });
+
+        std::optional<stream> responder{};
+        data_chunk prefix(stream::detection_size);
+        boost_code responded{ boost::asio::error::would_block };
+        const auto begin = steady_clock::now();
+        boost::asio::async_read(server,
+            boost::asio::mutable_buffer{ prefix.data(), prefix.size() },
+            [&](const boost_code&, size_t)
+            {
+                responder.emplace(std::move(server), configuration);
+                responder->async_handshake(std::move(prefix),
+                    [&](const boost_code& ec)
+                    {
+                        responded = ec;
+                        responding += steady_clock::now() - begin;
+                    });
+            });
+
+        service.run();
+        service.restart();
+        BOOST_REQUIRE(!responded);
+    }
+
+    const seconds_t elapsed{ steady_clock::now() - start };
+    report("handshake_garbage_responder_latency", size,
+        1e6 * responding.count() / handshakes, "us");
+    report("handshake_garbage_rate", size, handshakes / elapsed.count(),
+        "handshakes/s");
+}
+
+BOOST_AUTO_TEST_CASE(privacy_benchmark__handshake_garbage__loopback)
+{
+    handshake_garbage(zero);
+    handshake_garbage(256);
+    handshake_garbage(cipher::maximum_garbage);
+}
+
+// Cipher: encrypt and decrypt throughput by packet contents size.
+// ----------------------------------------------------------------------------
+
+static void cipher_throughput(size_t size)
+{
+    cipher alpha{};
+    cipher beta{};
+    BOOST_REQUIRE(alpha.initialize(beta.public_key(), mainnet, true));
+    BOOST_REQUIRE(beta.initialize(alpha.public_key(), mainnet, false));
+
+    const auto count = iterations(size, 16, 100'000);
+    const data_chunk contents(size, 0x42);
+    const data_chunk empty(size + cipher::expansion);
+    std::vector<data_chunk> packets(count, empty);
+
+    auto start = steady_clock::now();
+    for (auto& packet: packets)
+        alpha.encrypt(contents, {}, false, packet);
+
+    const seconds_t encrypting{ steady_clock::now() - start };
+
+    bool ignore{};
+    start = steady_clock::now();
+    for (auto& packet: packets)
+    {
+        const std::span<uint8_t> span{ packet };
+        const auto rest = span.subspan(cipher::length_size);
+        const auto length = beta.decrypt_length(
+            span.first(cipher::length_size));
+        BOOST_REQUIRE(beta.decrypt(rest.first(cipher::header_size + length),
+            {}, ignore, rest));
+    }
+
+    const seconds_t decrypting{ steady_clock::now() - start };
+    const auto bytes = static_cast<double>(count * size) / megabyte;
+    report("cipher_encrypt", size, bytes / encrypting.count(), "MiB/s");
+    report("cipher_decrypt", size, bytes / decrypting.count(), "MiB/s");
+    report("cipher_encrypt_packets", size, count / encrypting.count(),
+        "packets/s");
+    report("cipher_decrypt_packets", size, count / decrypting.count(),
+        "packets/s");
+}
+
+BOOST_AUTO_TEST_CASE(privacy_benchmark__cipher__throughput)
+{
+    const std::vector<size_t> sizes{ 1, 64, 250, 1'024, 4'096, 65'536,
+        megabyte };
+
+    for (const auto size: sizes)
+        cipher_throughput(size);
+}
+
+// Socket: v1 and v2 peer message throughput (peer_write to peer_read).
+// ----------------------------------------------------------------------------
+
+static void socket_throughput(const std::string& name,
+    const network::socket::context& context, size_t items)
+{
+    const logger log{};
+    threadpool pool(2);
+    asio::strand strand(pool.service().get_executor());
+    asio::acceptor acceptor(strand);
+    boost_code ec{};
+    const asio::endpoint bind(asio::ipv4::loopback(), 0);
+    acceptor.open(bind.protocol(), ec);
+    BOOST_REQUIRE(!ec);
+    acceptor.bind(bind, ec);
+    BOOST_REQUIRE(!ec);
+    acceptor.listen(1, ec);
+    BOOST_REQUIRE(!ec);
+
+    const network::socket::parameters params
+    {
+        .maximum_request = 4u * megabyte,
+        .context = context
+    };
+
+    const auto server = std::make_shared<network::socket>(log,
+        pool.service(), params);
+    const auto client = std::make_shared<network::socket>(log,
+        pool.service(), params, config::address{}, config::endpoint{}, false);
+
+    // Accept and connect each complete the transport handshake (if any).
+    std::promise<code> accepted{};
+    std::promise<code> connected{};
+    server->accept(acceptor, [&](const code& result)
+    {
+        accepted.set_value(result);
+    });
+    client->connect(asio::endpoints::create(acceptor.local_endpoint(), {}, {}),
+        [&](const code& result)
+        {
+            connected.set_value(result);
+        });
+
+    BOOST_REQUIRE_EQUAL(accepted.get_future().get(), error::success);
+    BOOST_REQUIRE_EQUAL(connected.get_future().get(), error::success);
+
+    constexpr uint32_t version = level::maximum_protocol;
+    const auto type = inventory::type_id::transaction;
+    const system::hashes hashes(items, system::null_hash);
+    const auto message = system::to_shared(inventory::factory(hashes, type));
+    const auto size = message->size(version);
+    const auto count = iterations(size, 16, 20'000);
+
+    std::promise<code> wrote{};
+    std::function<void(size_t)> write{};
+    write = [&](size_t remaining)
+    {
+        if (is_zero(remaining))
+        {
+            wrote.set_value(error::success);
+            return;
+        }
+
+        frame out{};
+        out.magic = mainnet;
+        out.version = version;
+        out.message = rpc::any_t{ message };
+        out.index = rpc::peer_registry::index_of<inventory>();
+        client->peer_write(std::move(out),
+            [&, remaining](const code& result, size_t)
+            {
+                if (result)
+                    wrote.set_value(result);
+                else
+                    write(sub1(remaining));
+            });
+    };
+
+    data_chunk buffer{};
+    frame in{};
+    std::promise<code> read{};
+    std::function<void(size_t)> read_next{};
+    read_next = [&](size_t remaining)
+    {
+        if (is_zero(remaining))
+        {
+            read.set_value(error::success);
+            return;
+        }
+
+        in = frame{};
+        in.magic = mainnet;
+        in.version = version;
+        in.maximum = params.maximum_request;
+        server->peer_read(buffer, in,
+            [&, remaining](const code& result, size_t)
+            {
+                if (result)
+                    read.set_value(result);
+                else
+                    read_next(sub1(remaining));
+            });
+    };
+
+    const auto start = steady_clock::now();
+    read_next(count);
+    write(count);
+    BOOST_REQUIRE_EQUAL(read.get_future().get(), error::success);
+    const seconds_t elapsed{ steady_clock::now() - start };
+    BOOST_REQUIRE_EQUAL(wrote.get_future().get(), error::success);
+
+    client->stop();
+    server->stop();
+    pool.stop();
+    BOOST_REQUIRE(pool.join());
+
+    const auto bytes = static_cast<double>(count * size) / megabyte;
+    report(name + "_messages", size, count / elapsed.count(), "messages/s");
+    report(name + "_bytes", size, bytes / elapsed.count(), "MiB/s");
+}
+
+BOOST_AUTO_TEST_CASE(privacy_benchmark__socket__v1_v2_throughput)
+{
+    const context configuration{ mainnet };
+    const network::socket::context v1{};
+    const network::socket::context v2{ std::cref(configuration) };
+
+    // Inventory of 1, 7, 1000 and 50000 items (37 bytes to ~1.7MiB).
+    const std::vector<size_t> counts{ 1, 7, 1'000, 50'000 };
+    for (const auto items: counts)
+    {
+        socket_throughput("socket_v1", v1, items);
+        socket_throughput("socket_v2", v2, items);
+    }
+}
+
+#endif // HAVE_SLOW_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
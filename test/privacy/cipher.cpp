@@ -54,6 +54,28 @@ BOOST_AUTO_TEST_CASE(privacy_cipher__encrypt__vector_1__expected)
     BOOST_REQUIRE_EQUAL(out, expected);
 }
 
+// bips.dev/324 packet encoding test vector 1, encrypted in place.
+BOOST_AUTO_TEST_CASE(privacy_cipher__encrypt__in_place_vector_1__expected)
+{
+    const ec_secret secret = base16_array("61062ea5071d800bbfd59e2e8b53d47d194b095ae5a4df04936b49772ef0d4d7");
+    const cipher::key ours = base16_array("ec0adff257bbfe500c188c80b4fdd640f6b45a482bbc15fc7cef5931deff0aa186f6eb9bba7b85dc4dcc28b28722de1e3d9108b985e2967045668f66098e475b");
+    const cipher::key theirs = base16_array("a4a94dfce69b4a2a0a099313d10f9f7e7d649d60501c9e1d274c300e0d89aafaffffffffffffffffffffffffffffffffffffffffffffffffffffffff8faf88d5");
+    const auto expected = base16_chunk("7530d2a18720162ac09c25329a60d75adf36eda3c3");
+
+    cipher self{ secret, ours };
+    BOOST_REQUIRE(self.initialize(theirs, mainnet, true));
+
+    // Seek to packet index 1 with one decoy encryption (in place).
+    data_chunk decoy(cipher::expansion);
+    self.encrypt(decoy, true);
+
+    // Contents are written at their final offset (after length and header).
+    data_chunk packet(one + cipher::expansion);
+    packet.at(cipher::length_size + cipher::header_size) = 0x8e;
+    self.encrypt(packet, false);
+    BOOST_REQUIRE_EQUAL(packet, expected);
+}
+
 // bips.dev/324 packet encoding test vector 2 (responding, packet index 999).
 BOOST_AUTO_TEST_CASE(privacy_cipher__encrypt__vector_2__expected)
 {
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <optional>
+#include <thread>
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(privacy_keypool_tests)
+
+using namespace network::privacy;
+
+// Wait for the refill thread to fill the pool to capacity.
+static void await_full(const keypool& pool)
+{
+    const auto limit = steady_clock::now() + seconds(10);
+    while (pool.size() < pool.capacity() && steady_clock::now() < limit)
+        std::this_thread::sleep_for(milliseconds(1));
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__construct__zero__capacity_one)
+{
+    const keypool pool{ 0 };
+    BOOST_REQUIRE_EQUAL(pool.capacity(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__construct__refilled__full)
+{
+    const keypool pool{ 4 };
+    await_full(pool);
+    BOOST_REQUIRE_EQUAL(pool.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__take__full__distinct_valid_keys)
+{
+    keypool pool{ 2 };
+    await_full(pool);
+
+    system::ec_secret secret1{};
+    system::ec_secret secret2{};
+    keypool::key key1{};
+    keypool::key key2{};
+    BOOST_REQUIRE(pool.take(secret1, key1));
+    BOOST_REQUIRE(pool.take(secret2, key2));
+    BOOST_REQUIRE(secret1 != system::ec_secret{});
+    BOOST_REQUIRE(secret1 != secret2);
+    BOOST_REQUIRE(key1 != key2);
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__take__exhausted__refilled)
+{
+    keypool pool{ 1 };
+    await_full(pool);
+
+    system::ec_secret secret{};
+    keypool::key key{};
+    BOOST_REQUIRE(pool.take(secret, key));
+    await_full(pool);
+    BOOST_REQUIRE_EQUAL(pool.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__cipher__pooled__exchanges_with_generated)
+{
+    const auto pool = std::make_shared<keypool>(2);
+    await_full(*pool);
+
+    cipher alpha{ pool };
+    cipher beta{};
+    BOOST_REQUIRE_EQUAL(pool->size() + 1u, 2u);
+    BOOST_REQUIRE(alpha.initialize(beta.public_key(), 42, true));
+    BOOST_REQUIRE(beta.initialize(alpha.public_key(), 42, false));
+    BOOST_REQUIRE_EQUAL(alpha.session_id(), beta.session_id());
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__cipher__null_pool__generated)
+{
+    cipher alpha{ keypool::ptr{} };
+    cipher beta{};
+    BOOST_REQUIRE(alpha.initialize(beta.public_key(), 42, true));
+    BOOST_REQUIRE(beta.initialize(alpha.public_key(), 42, false));
+    BOOST_REQUIRE_EQUAL(alpha.session_id(), beta.session_id());
+}
+
+#if defined(HAVE_SLOW_TESTS)
+
+using tcp_socket = network::asio::socket;
+constexpr uint32_t mainnet = 0xd9b4bef9;
+constexpr size_t handshakes = 200;
+
+// Complete loopback v2 handshakes, returning handshakes per second.
+static double handshake_rate(const context& configuration)
+{
+    boost::asio::io_context service{};
+    boost::asio::ip::tcp::acceptor acceptor{ service,
+        { boost::asio::ip::address_v4::loopback(), 0 } };
+
+    const auto start = steady_clock::now();
+    for (size_t count{}; count < handshakes; ++count)
+    {
+        tcp_socket server{ service };
+        tcp_socket client{ service };
+        acceptor.async_accept(server, [](const boost_code&) {});
+        client.async_connect(acceptor.local_endpoint(),
+            [](const boost_code&) {});
+        service.run();
+        service.restart();
+
+        // The responder is constructed following detection, as by socket.
+        stream initiator{ std::move(client), configuration };
+        std::optional<stream> responder{};
+        system::data_chunk prefix(stream::detection_size);
+        boost_code initiated{};
+        boost_code responded{};
+
+        initiator.async_handshake([&](const boost_code& ec)
+        {
+            initiated = ec;
+        });
+        boost::asio::async_read(server,
+            boost::asio::mutable_buffer{ prefix.data(), prefix.size() },
+            [&](const boost_code&, size_t)
+            {
+                responder.emplace(std::move(server), configuration);
+                responder->async_handshake(std::move(prefix),
+                    [&](const boost_code& ec) { responded = ec; });
+            });
+
+        service.run();
+        service.restart();
+        BOOST_REQUIRE(!initiated && !responded);
+    }
+
+    const std::chrono::duration<double> elapsed{ steady_clock::now() - start };
+    return handshakes / elapsed.count();
+}
+
+BOOST_AUTO_TEST_CASE(privacy_keypool__benchmark__loopback_handshakes)
+{
+    const context generated{ mainnet };
+    const context pooled{ mainnet, std::make_shared<keypool>(2 * handshakes) };
+    await_full(*pooled.keys);
+
+    const auto without = handshake_rate(generated);
+    const auto with = handshake_rate(pooled);
+    BOOST_TEST_MESSAGE("generated handshakes/sec: " << without);
+    BOOST_TEST_MESSAGE("pooled handshakes/sec   : " << with);
+    BOOST_REQUIRE_GT(with, 0.0);
+}
+
+#endif // HAVE_SLOW_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
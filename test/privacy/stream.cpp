@@ -68,6 +68,43 @@ static data_chunk v1_frame(const std::string& command,
     return frame;
 }
 
+// Complete a v2 handshake over a local socket pair (both with read_ahead).
+static void handshake_pair(boost::asio::io_context& service,
+    const v2_context& configuration, size_t read_ahead,
+    std::optional<v2_stream>& initiator, std::optional<v2_stream>& responder)
+{
+    tcp_socket server{ service };
+    tcp_socket client{ service };
+    connect_pair(service, server, client);
+
+    boost_code initiated{ boost::asio::error::would_block };
+    boost_code responded{ boost::asio::error::would_block };
+    data_chunk prefix(v2_stream::detection_size);
+
+    initiator.emplace(std::move(client), configuration, read_ahead);
+    initiator->async_handshake([&](const boost_code& ec)
+    {
+        initiated = ec;
+    });
+    boost::asio::async_read(server,
+        boost::asio::mutable_buffer{ prefix.data(), prefix.size() },
+        [&](const boost_code& ec, size_t)
+        {
+            BOOST_REQUIRE(!ec);
+            responder.emplace(std::move(server), configuration, read_ahead);
+            responder->async_handshake(std::move(prefix),
+                [&](const boost_code& code)
+                {
+                    responded = code;
+                });
+        });
+
+    service.run();
+    service.restart();
+    BOOST_REQUIRE(!initiated);
+    BOOST_REQUIRE(!responded);
+}
+
 BOOST_AUTO_TEST_CASE(privacy_stream__handshake__v2_both_sides__frames_round_trip)
 {
     boost::asio::io_context service{};
@@ -184,6 +221,220 @@ BOOST_AUTO_TEST_CASE(privacy_stream__handshake__v2_both_sides__frames_round_trip
     BOOST_REQUIRE_EQUAL(identifier, identifiers::inventory);
     BOOST_REQUIRE(command.empty());
     BOOST_REQUIRE_EQUAL(payload, inv_payload);
+
+    // A payload serialized in place into the packet buffer (pong).
+    const auto pong_payload = system::base16_chunk("8899aabbccddeeff");
+    const auto writer = [&](const std::span<uint8_t>& out)
+    {
+        std::copy(pong_payload.begin(), pong_payload.end(), out.begin());
+        return true;
+    };
+    sent = boost::asio::error::would_block;
+    initiator.async_write_message(identifiers::pong, "", pong_payload.size(),
+        writer, on_sent);
+
+    read_message(responder);
+    service.run();
+    service.restart();
+    BOOST_REQUIRE(!sent);
+    BOOST_REQUIRE(!got);
+    BOOST_REQUIRE_EQUAL(identifier, identifiers::pong);
+    BOOST_REQUIRE(command.empty());
+    BOOST_REQUIRE_EQUAL(payload, pong_payload);
+
+    // A failed in place serialization is not written.
+    sent = boost::asio::error::would_block;
+    initiator.async_write_message(identifiers::pong, "", one,
+        [](const std::span<uint8_t>&) { return false; }, on_sent);
+
+    service.run();
+    service.restart();
+    BOOST_REQUIRE(sent);
+}
+
+BOOST_AUTO_TEST_CASE(privacy_stream__read_ahead__batched_packets__surfaced_in_order)
+{
+    boost::asio::io_context service{};
+    const v2_context configuration{ mainnet };
+    std::optional<v2_stream> initiator{};
+    std::optional<v2_stream> responder{};
+    handshake_pair(service, configuration, 4096, initiator, responder);
+
+    // Small packets written back to back arrive in one read-ahead fill.
+    size_t sent{};
+    const auto on_sent = [&](const boost_code& ec, size_t)
+    {
+        BOOST_REQUIRE(!ec);
+        ++sent;
+    };
+
+    const std::vector<data_chunk> payloads
+    {
+        system::base16_chunk("00"),
+        system::base16_chunk("0011223344556677"),
+        system::base16_chunk("8899aabbccddeeff")
+    };
+
+    // Writes do not overlap, so each completes before the next.
+    const std::vector<uint8_t> ids
+    {
+        identifiers::inventory,
+        identifiers::ping,
+        identifiers::pong
+    };
+
+    for (size_t index{}; index < ids.size(); ++index)
+    {
+        initiator->async_write_message(ids.at(index), "",
+            system::to_shared(payloads.at(index)), on_sent);
+        service.run();
+        service.restart();
+    }
+
+    BOOST_REQUIRE_EQUAL(sent, 3u);
+
+    // Each read completes in order, from the read-ahead after the first.
+    data_chunk buffer{};
+    std::vector<uint8_t> received{};
+    std::vector<data_chunk> contents{};
+    using payload_t = v2_stream::payload_t;
+    constexpr auto maximum = network::privacy::cipher::maximum_content;
+    v2_stream::message_handler on_message{};
+
+    on_message = [&](const boost_code& ec, uint8_t id, const std::string&,
+        const payload_t& data)
+    {
+        BOOST_REQUIRE(!ec);
+        received.push_back(id);
+        contents.emplace_back(data.begin(), data.end());
+        if (received.size() < payloads.size())
+            responder->async_read_message(buffer, maximum,
+                v2_stream::message_handler{ on_message });
+    };
+
+    responder->async_read_message(buffer, maximum,
+        v2_stream::message_handler{ on_message });
+    service.run();
+    service.restart();
+
+    BOOST_REQUIRE_EQUAL(received.size(), 3u);
+    BOOST_REQUIRE_EQUAL(received, ids);
+    BOOST_REQUIRE_EQUAL(contents.at(0), payloads.at(0));
+    BOOST_REQUIRE_EQUAL(contents.at(1), payloads.at(1));
+    BOOST_REQUIRE_EQUAL(contents.at(2), payloads.at(2));
+}
+
+BOOST_AUTO_TEST_CASE(privacy_stream__async_write_messages__batch__surfaced_in_order)
+{
+    boost::asio::io_context service{};
+    const v2_context configuration{ mainnet };
+    std::optional<v2_stream> initiator{};
+    std::optional<v2_stream> responder{};
+    handshake_pair(service, configuration, zero, initiator, responder);
+
+    const std::vector<data_chunk> payloads
+    {
+        system::base16_chunk("00"),
+        system::base16_chunk("0011223344556677"),
+        system::base16_chunk("deadbeef")
+    };
+
+    const auto writer = [&](size_t index)
+    {
+        return [&, index](const std::span<uint8_t>& out)
+        {
+            const auto& payload = payloads.at(index);
+            std::copy(payload.begin(), payload.end(), out.begin());
+            return true;
+        };
+    };
+
+    // Three messages (one with a command) become one write of three packets.
+    v2_stream::outgoings messages{};
+    messages.push_back({ identifiers::inventory, "", 1, writer(0) });
+    messages.push_back({ identifiers::ping, "", 8, writer(1) });
+    messages.push_back({ identifiers::unassigned, "version", 4, writer(2) });
+
+    size_t expected{};
+    for (const auto& message: messages)
+        expected += v2_stream::packet_size(message.identifier, message.size);
+
+    boost_code sent{ boost::asio::error::would_block };
+    size_t bytes{};
+    initiator->async_write_messages(std::move(messages),
+        [&](const boost_code& ec, size_t size)
+        {
+            sent = ec;
+            bytes = size;
+        });
+
+    service.run();
+    service.restart();
+    BOOST_REQUIRE(!sent);
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+
+    data_chunk buffer{};
+    std::vector<std::string> commands{};
+    data_chunk received{};
+    std::vector<data_chunk> contents{};
+    using payload_t = v2_stream::payload_t;
+    constexpr auto maximum = network::privacy::cipher::maximum_content;
+    v2_stream::message_handler on_message{};
+
+    on_message = [&](const boost_code& ec, uint8_t id,
+        const std::string& command, const payload_t& data)
+    {
+        BOOST_REQUIRE(!ec);
+        received.push_back(id);
+        commands.push_back(command);
+        contents.emplace_back(data.begin(), data.end());
+        if (received.size() < payloads.size())
+            responder->async_read_message(buffer, maximum,
+                v2_stream::message_handler{ on_message });
+    };
+
+    responder->async_read_message(buffer, maximum,
+        v2_stream::message_handler{ on_message });
+    service.run();
+    service.restart();
+
+    BOOST_REQUIRE_EQUAL(received.size(), 3u);
+    BOOST_REQUIRE_EQUAL(received.at(0), identifiers::inventory);
+    BOOST_REQUIRE_EQUAL(received.at(1), identifiers::ping);
+    BOOST_REQUIRE_EQUAL(received.at(2), identifiers::unassigned);
+    BOOST_REQUIRE_EQUAL(commands.at(2), "version");
+    BOOST_REQUIRE_EQUAL(contents.at(0), payloads.at(0));
+    BOOST_REQUIRE_EQUAL(contents.at(1), payloads.at(1));
+    BOOST_REQUIRE_EQUAL(contents.at(2), payloads.at(2));
+}
+
+BOOST_AUTO_TEST_CASE(privacy_stream__async_write_messages__failed_writer__nothing_sent)
+{
+    boost::asio::io_context service{};
+    const v2_context configuration{ mainnet };
+    std::optional<v2_stream> initiator{};
+    std::optional<v2_stream> responder{};
+    handshake_pair(service, configuration, zero, initiator, responder);
+
+    const auto good = [](const std::span<uint8_t>&) { return true; };
+    const auto bad = [](const std::span<uint8_t>&) { return false; };
+    v2_stream::outgoings messages{};
+    messages.push_back({ identifiers::ping, "", 8, good });
+    messages.push_back({ identifiers::pong, "", 8, bad });
+
+    boost_code sent{};
+    size_t bytes{ 42 };
+    initiator->async_write_messages(std::move(messages),
+        [&](const boost_code& ec, size_t size)
+        {
+            sent = ec;
+            bytes = size;
+        });
+
+    service.run();
+    service.restart();
+    BOOST_REQUIRE(sent);
+    BOOST_REQUIRE(is_zero(bytes));
 }
 
 BOOST_AUTO_TEST_CASE(privacy_stream__detected_v1__version_prefix__true)
@@ -213,10 +213,11 @@ public:
     }
 
     connector::ptr create_connector(const settings::socks5& socks,
-        const steady_clock::duration& timeout, uint32_t maximum) NOEXCEPT override
+        const steady_clock::duration& timeout, uint32_t maximum,
+        const socket::tuning& tuning) NOEXCEPT override
     {
         ++connectors_;
-        return net::create_connector(socks, timeout, maximum);
+        return net::create_connector(socks, timeout, maximum, tuning);
     }
 
     size_t acceptors() const NOEXCEPT
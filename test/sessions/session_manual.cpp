@@ -233,7 +233,8 @@ public:
 
     // Create mock connector to inject mock channel.
     connector::ptr create_connector(const settings::socks5& ,
-        const steady_clock::duration& timeout, uint32_t maximum) NOEXCEPT override
+        const steady_clock::duration& timeout, uint32_t maximum,
+        const socket::tuning&) NOEXCEPT override
     {
         connector::parameters params
         {
@@ -38,6 +38,7 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(instance.protocol_minimum, level::minimum_protocol);
     BOOST_REQUIRE_EQUAL(instance.invalid_services, 176u);
     BOOST_REQUIRE_EQUAL(instance.enable_privacy, false);
+    BOOST_REQUIRE_EQUAL(instance.privacy_keypool, 64u);
     BOOST_REQUIRE_EQUAL(instance.enable_address, false);
     BOOST_REQUIRE_EQUAL(instance.enable_address_v2, false);
     BOOST_REQUIRE_EQUAL(instance.enable_witness_tx, false);
@@ -49,10 +50,17 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(instance.identifier, 3652501241u);
     BOOST_REQUIRE_EQUAL(instance.retry_timeout_seconds, 1u);
     BOOST_REQUIRE_EQUAL(instance.connect_timeout_seconds, 5u);
+    BOOST_REQUIRE_EQUAL(instance.connect_stagger_milliseconds, 250u);
     BOOST_REQUIRE_EQUAL(instance.handshake_timeout_seconds, 15u);
     BOOST_REQUIRE_EQUAL(instance.channel_heartbeat_minutes, 5u);
     BOOST_REQUIRE_EQUAL(instance.maximum_skew_minutes, 120u);
+    BOOST_REQUIRE_EQUAL(instance.resolve_cache_seconds, 60u);
     BOOST_REQUIRE_EQUAL(instance.rate_limit, 0u);
+    BOOST_REQUIRE_EQUAL(instance.egress_limit, 0u);
+    BOOST_REQUIRE_EQUAL(instance.ingress_limit, 0u);
+    BOOST_REQUIRE_EQUAL(instance.queue_high_water, 0u);
+    BOOST_REQUIRE_EQUAL(instance.queue_maximum, 0u);
+    BOOST_REQUIRE_EQUAL(instance.read_ahead, 0u);
     BOOST_REQUIRE_EQUAL(instance.user_agent, BC_USER_AGENT);
     BOOST_REQUIRE(instance.path.empty());
     BOOST_REQUIRE(instance.blacklists.empty());
@@ -95,6 +103,29 @@ BOOST_AUTO_TEST_CASE(settings__connect_timeout__always__between_zero_and_connect
     BOOST_REQUIRE(instance.connect_timeout() <= seconds{ instance.connect_timeout_seconds });
 }
 
+BOOST_AUTO_TEST_CASE(settings__resolve_cache__always__resolve_cache_seconds)
+{
+    settings instance{ system::chain::selection::mainnet };
+    constexpr auto expected = 42u;
+    instance.resolve_cache_seconds = expected;
+    BOOST_REQUIRE(instance.resolve_cache() == seconds(expected));
+}
+
+BOOST_AUTO_TEST_CASE(settings__resolve_cache__zero__disabled)
+{
+    settings instance{ system::chain::selection::mainnet };
+    instance.resolve_cache_seconds = 0;
+    BOOST_REQUIRE(is_zero(instance.resolve_cache().count()));
+}
+
+BOOST_AUTO_TEST_CASE(settings__connect_stagger__always__connect_stagger_milliseconds)
+{
+    settings instance{ system::chain::selection::mainnet };
+    constexpr auto expected = 42u;
+    instance.connect_stagger_milliseconds = expected;
+    BOOST_REQUIRE(instance.connect_stagger() == milliseconds(expected));
+}
+
 BOOST_AUTO_TEST_CASE(settings__channel_handshake__always__handshake_timeout_seconds)
 {
     settings instance{ system::chain::selection::mainnet };
@@ -296,11 +327,76 @@ BOOST_AUTO_TEST_CASE(settings__tcp_server__defaults__expected)
     BOOST_REQUIRE_EQUAL(instance.maximum_request, maximum_request);
     BOOST_REQUIRE_EQUAL(instance.minimum_buffer, maximum_request);
     BOOST_REQUIRE_EQUAL(instance.rate_limit, 0u);
+    BOOST_REQUIRE_EQUAL(instance.egress_weight, 1u);
+    BOOST_REQUIRE_EQUAL(instance.read_limit, 0u);
+    BOOST_REQUIRE_EQUAL(instance.queue_high_water, 0u);
+    BOOST_REQUIRE_EQUAL(instance.queue_maximum, 0u);
+    BOOST_REQUIRE(!instance.no_delay);
+    BOOST_REQUIRE_EQUAL(instance.send_buffer, 0u);
+    BOOST_REQUIRE_EQUAL(instance.receive_buffer, 0u);
+    BOOST_REQUIRE_EQUAL(instance.unsent_low_water, 0u);
+    BOOST_REQUIRE_EQUAL(instance.keepalive_idle_seconds, 0u);
+    BOOST_REQUIRE_EQUAL(instance.keepalive_interval_seconds, 0u);
+    BOOST_REQUIRE_EQUAL(instance.keepalive_probes, 0u);
+    BOOST_REQUIRE_EQUAL(instance.user_timeout_milliseconds, 0u);
+    BOOST_REQUIRE_EQUAL(instance.listen_backlog, 0u);
+    BOOST_REQUIRE_EQUAL(instance.acceptors, 1u);
+    BOOST_REQUIRE(!instance.fast_open);
+    BOOST_REQUIRE_EQUAL(instance.fast_open_queue, 16u);
     BOOST_REQUIRE(!instance.enabled());
     BOOST_REQUIRE(instance.inactivity() == minutes(10));
     BOOST_REQUIRE(instance.expiration() == minutes(60));
 }
 
+BOOST_AUTO_TEST_CASE(settings__tcp_server__socket_tuning__defaults__system)
+{
+    const settings::tcp_server instance{ "test" };
+    const auto tuning = instance.socket_tuning();
+    BOOST_REQUIRE(!tuning.no_delay);
+    BOOST_REQUIRE_EQUAL(tuning.send_buffer, 0u);
+    BOOST_REQUIRE_EQUAL(tuning.receive_buffer, 0u);
+    BOOST_REQUIRE_EQUAL(tuning.unsent_low_water, 0u);
+    BOOST_REQUIRE(is_zero(tuning.keepalive_idle.count()));
+    BOOST_REQUIRE(is_zero(tuning.keepalive_interval.count()));
+    BOOST_REQUIRE_EQUAL(tuning.keepalive_probes, 0u);
+    BOOST_REQUIRE(is_zero(tuning.user_timeout.count()));
+    BOOST_REQUIRE_EQUAL(tuning.backlog, 0u);
+    BOOST_REQUIRE(!tuning.reuse_port);
+    BOOST_REQUIRE(!tuning.fast_open);
+    BOOST_REQUIRE_EQUAL(tuning.fast_open_queue, 16u);
+}
+
+BOOST_AUTO_TEST_CASE(settings__tcp_server__socket_tuning__configured__expected)
+{
+    settings::tcp_server instance{ "test" };
+    instance.no_delay = true;
+    instance.send_buffer = 1;
+    instance.receive_buffer = 2;
+    instance.unsent_low_water = 3;
+    instance.keepalive_idle_seconds = 4;
+    instance.keepalive_interval_seconds = 5;
+    instance.keepalive_probes = 6;
+    instance.user_timeout_milliseconds = 7;
+    instance.listen_backlog = 8;
+    instance.acceptors = 0;
+    instance.fast_open = true;
+    instance.fast_open_queue = 9;
+
+    const auto tuning = instance.socket_tuning();
+    BOOST_REQUIRE(tuning.no_delay);
+    BOOST_REQUIRE_EQUAL(tuning.send_buffer, 1u);
+    BOOST_REQUIRE_EQUAL(tuning.receive_buffer, 2u);
+    BOOST_REQUIRE_EQUAL(tuning.unsent_low_water, 3u);
+    BOOST_REQUIRE(tuning.keepalive_idle == seconds(4));
+    BOOST_REQUIRE(tuning.keepalive_interval == seconds(5));
+    BOOST_REQUIRE_EQUAL(tuning.keepalive_probes, 6u);
+    BOOST_REQUIRE(tuning.user_timeout == milliseconds(7));
+    BOOST_REQUIRE_EQUAL(tuning.backlog, 8u);
+    BOOST_REQUIRE(tuning.reuse_port);
+    BOOST_REQUIRE(tuning.fast_open);
+    BOOST_REQUIRE_EQUAL(tuning.fast_open_queue, 9u);
+}
+
 BOOST_AUTO_TEST_CASE(settings__tls_server__defaults__expected)
 {
     constexpr auto name = "test";